@@ -0,0 +1,106 @@
+/*
+ * File:   BitStream.h
+ */
+
+#ifndef LCTL_CODEGENERATION_BITSTREAM_H
+#define LCTL_CODEGENERATION_BITSTREAM_H
+
+#include "../Definitions.h"
+#include <cstdint>
+#include <cstring>
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  /**
+   * @brief Writes values with a runtime known number of bits one after the other into a byte stream,
+   * the first value in the lowest bits. Full 64 bit words are stored at once.
+   */
+  struct BitWriter {
+    uint8_t * out;
+    uint64_t buffer = 0;
+    /* number of used bits in buffer */
+    size_t fill = 0;
+
+    explicit BitWriter(uint8_t * out) : out(out) {}
+
+    /**
+     * @brief appends the lowest numberOfBits bits of value (numberOfBits <= 64)
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE void put(uint64_t value, const size_t numberOfBits) {
+      if (numberOfBits == 0)
+        return;
+      if (numberOfBits < 64)
+        value &= ((uint64_t) 1 << numberOfBits) - 1;
+      buffer |= value << fill;
+      if (fill + numberOfBits < 64) {
+        fill += numberOfBits;
+        return;
+      }
+      std::memcpy(out, &buffer, sizeof(uint64_t));
+      out += sizeof(uint64_t);
+      /* bits of value, which did not fit into the full buffer */
+      buffer = fill == 0 ? 0 : value >> (64 - fill);
+      fill = fill + numberOfBits - 64;
+    }
+
+    /**
+     * @brief writes the remaining bits, returns the end of the byte stream
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE uint8_t * flush() {
+      const size_t bytes = (fill + 7) / 8;
+      std::memcpy(out, &buffer, bytes);
+      out += bytes;
+      buffer = 0;
+      fill = 0;
+      return out;
+    }
+  };
+
+  /**
+   * @brief Reads values with a runtime known number of bits from a byte stream written by BitWriter.
+   * Bytes are loaded one by one, nothing behind the stream is read.
+   */
+  struct BitReader {
+    const uint8_t * in;
+    uint64_t buffer = 0;
+    /* number of unread bits in buffer */
+    size_t fill = 0;
+
+    explicit BitReader(const uint8_t * in) : in(in) {}
+
+    /**
+     * @brief reads the next numberOfBits bits (numberOfBits <= 64)
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE uint64_t get(const size_t numberOfBits) {
+      if (numberOfBits > 32) {
+        const uint64_t low = getShort(32);
+        return low | (getShort(numberOfBits - 32) << 32);
+      }
+      return getShort(numberOfBits);
+    }
+
+    /**
+     * @brief reads the next numberOfBits bits (numberOfBits <= 32)
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE uint64_t getShort(const size_t numberOfBits) {
+      while (fill < numberOfBits) {
+        buffer |= (uint64_t) *in << fill;
+        in++;
+        fill += 8;
+      }
+      const uint64_t ret = buffer & (((uint64_t) 1 << numberOfBits) - 1);
+      buffer >>= numberOfBits;
+      fill -= numberOfBits;
+      return ret;
+    }
+
+    /**
+     * @brief end of the consumed bytes of the stream
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE const uint8_t * position() const {
+      return in;
+    }
+  };
+}
+#endif /* LCTL_CODEGENERATION_BITSTREAM_H */
@@ -6,6 +6,7 @@
  */
 
 #include "../Definitions.h"
+#include "./ProcessingStyle.h"
 
 #ifndef LCTL_CODEGENERATION_INCREMENT_H
 #define LCTL_CODEGENERATION_INCREMENT_H
@@ -18,8 +19,6 @@ namespace LCTL {
    * @tparam tokensize_t        increase pointer by tokensize_t, if tokensize_t is known at compiletime
    * @tparam processingStyle     TVL Processing Style, contains also datatype to handle the memory region of compressed and decompressed values
    * 
-   * @todo do this in SIMD case vectorwise
-   * 
    * @date: 26.05.2021 12:00
    * @author: Juliana Hildebrandt
    */
@@ -70,6 +69,22 @@ namespace LCTL {
 
     MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(base_t * &  src, size_t tokensize){};
   };
+
+  /**
+   * @brief Increase a pointer to compressed data by vectorcount_t vector registers of the processing style.
+   * In a vertical SIMD layout, one compressed word per lane is one register, i.e. sse<v128<uint32_t>> advances by 4 words,
+   * in the scalar case, it is the same as Incr<doOrDont, base_t, vectorcount_t>.
+   *
+   * @tparam doOrDont           increase pointer or not
+   * @tparam processingStyle_t  TVL Processing Style, contains also datatype to handle the memory region of compressed values
+   * @tparam vectorcount_t      number of vector registers
+   */
+  template<bool doOrDont, class processingStyle_t, size_t vectorcount_t = 1>
+  using IncrVector = Incr<
+    doOrDont,
+    typename processingStyle_t::base_t,
+    vectorcount_t * LaneCount<processingStyle_t>::value
+  >;
 }
 #endif /* LCTL_CODEGENERATION_INCREMENT_H */
 
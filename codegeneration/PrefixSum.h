@@ -0,0 +1,104 @@
+/*
+ * File:   PrefixSum.h
+ */
+
+#ifndef LCTL_CODEGENERATION_PREFIXSUM_H
+#define LCTL_CODEGENERATION_PREFIXSUM_H
+
+#include "../Definitions.h"
+#include "./SimdRegister.h"
+#include <cstdint>
+#include <cstring>
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+#if LCTL_SIMDREGISTER_BYTES >= 16
+  /**
+   * @brief inclusive prefix sum inside of one 128 bit register: log2(lanes) shifts by 1, 2, 4, ... lanes and additions
+   */
+  template <size_t lanesize_t, size_t shift_t = lanesize_t>
+  struct PrefixSumRegister {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static __m128i apply(const __m128i value) {
+      return PrefixSumRegister<lanesize_t, shift_t * 2>::apply(
+        SimdLanes<16, lanesize_t>::add(value, SimdRegister<16>::shiftLeftBytes<shift_t>(value))
+      );
+    }
+  };
+
+  template <size_t lanesize_t>
+  struct PrefixSumRegister<lanesize_t, 16> {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static __m128i apply(const __m128i value) {
+      return value;
+    }
+  };
+#endif
+
+  /**
+   * @brief In place decoding of differences with distance_t: values[i] += values[i - distance_t],
+   * the first distance_t values are differences to reference.
+   *
+   * D1 (distance_t = 1): with a 128 bit SIMD register (see SimdRegister.h), the prefix sum of each register is calculated in the register
+   * and the last lane of the previous register is added as carry.
+   * Thus, there is only one dependent addition per register instead of one per value.
+   *
+   * D4 (distance_t = 4): with a 128 bit SIMD register and lanes of at least 4 bytes, the sums are lane-wise vertical additions
+   * of the registers distance_t values before, there is no horizontal dependency at all.
+   * Smaller lanes use the scalar loop with distance_t independent chains.
+   *
+   * @tparam distance_t  distance of the subtrahend
+   * @tparam base_t      datatype of the values
+   */
+  template <size_t distance_t, typename base_t>
+  struct PrefixSum {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(base_t * values, const size_t count, const base_t reference) {
+      size_t i = 0;
+#if LCTL_SIMDREGISTER_BYTES >= 16
+      constexpr size_t lanes = 16 / sizeof(base_t);
+      /* number of registers between a value and its subtrahend */
+      constexpr size_t registers = distance_t * sizeof(base_t) % 16 == 0 ? distance_t * sizeof(base_t) / 16 : 1;
+      if (distance_t * sizeof(base_t) % 16 == 0) {
+        __m128i carry[registers];
+        for (size_t r = 0; r < registers; r++)
+          carry[r] = broadcast<16>(reference);
+        for (; i + lanes <= count; i += lanes) {
+          __m128i & previous = carry[(i / lanes) % registers];
+          previous = SimdLanes<16, sizeof(base_t)>::add(SimdRegister<16>::load(values + i), previous);
+          SimdRegister<16>::store(values + i, previous);
+        }
+      }
+#endif
+      for (; i < count && i < distance_t; i++)
+        values[i] = (base_t) (values[i] + reference);
+      for (; i < count; i++)
+        values[i] = (base_t) (values[i] + values[i - distance_t]);
+    }
+  };
+
+  template <typename base_t>
+  struct PrefixSum<1, base_t> {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(base_t * values, const size_t count, const base_t reference) {
+      size_t i = 0;
+      base_t last = reference;
+#if LCTL_SIMDREGISTER_BYTES >= 16
+      constexpr size_t lanes = 16 / sizeof(base_t);
+      __m128i carry = broadcast<16>(reference);
+      for (; i + lanes <= count; i += lanes) {
+        const __m128i sum = SimdLanes<16, sizeof(base_t)>::add(
+          PrefixSumRegister<sizeof(base_t)>::apply(SimdRegister<16>::load(values + i)),
+          carry
+        );
+        SimdRegister<16>::store(values + i, sum);
+        carry = broadcastLastLane<base_t>(sum);
+      }
+      if (i > 0)
+        last = values[i - 1];
+#endif
+      for (; i < count; i++) {
+        last = (base_t) (values[i] + last);
+        values[i] = last;
+      }
+    }
+  };
+}
+#endif /* LCTL_CODEGENERATION_PREFIXSUM_H */
@@ -0,0 +1,43 @@
+/*
+ * File:   ProcessingStyle.h
+ */
+
+#ifndef LCTL_CODEGENERATION_PROCESSINGSTYLE_H
+#define LCTL_CODEGENERATION_PROCESSINGSTYLE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <header/vector_extension_structs.h>
+
+namespace LCTL {
+  /**
+   * @brief true, iff the TVL processing style works on vector registers (sse, avx2, avx512).
+   * Same test as in ColumnFormat: scalar processing styles have vector_t == base_t.
+   *
+   * @tparam processingStyle_t  TVL Processing Style
+   */
+  template <class processingStyle_t>
+  struct IsVectorized : std::integral_constant<
+    bool,
+    !std::is_same<typename processingStyle_t::base_t, typename processingStyle_t::vector_t>::value
+  >{};
+
+  /**
+   * @brief number of values of type processingStyle_t::base_t in one register of the processing style.
+   * In scalar cases this is 1, i.e. for avx2<v256<uint32_t>> it is 8.
+   *
+   * In a vertical layout, each lane encodes its own sequence of values:
+   * the i-th value of a block is stored in lane i % LaneCount,
+   * and one compressed word in the scalar case corresponds to one vector register
+   * (LaneCount compressed words) in the SIMD case.
+   * Thus, all pointer increments concerning tokens and compressed words have to be scaled with LaneCount.
+   *
+   * @tparam processingStyle_t  TVL Processing Style
+   */
+  template <class processingStyle_t>
+  struct LaneCount : std::integral_constant<
+    size_t,
+    processingStyle_t::vector_helper_t::element_count::value
+  >{};
+}
+#endif /* LCTL_CODEGENERATION_PROCESSINGSTYLE_H */
@@ -0,0 +1,132 @@
+/*
+ * File:   Reduction.h
+ */
+
+#ifndef LCTL_CODEGENERATION_REDUCTION_H
+#define LCTL_CODEGENERATION_REDUCTION_H
+
+#include "../Definitions.h"
+#include "./SimdRegister.h"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <header/preprocessor.h>
+
+#if defined(__LZCNT__)
+#include <immintrin.h>
+#endif
+
+namespace LCTL {
+
+  /**
+   * @brief number of used bits of value (position of the highest set bit), 0 for value 0.
+   * With LZCNT, the leading zeros of 0 are defined (64), otherwise the zero case is a separate branch,
+   * because __builtin_clzll(0) is undefined.
+   */
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t usedBits(const uint64_t value) {
+#if defined(__LZCNT__)
+    return 64 - (size_t) _lzcnt_u64(value);
+#else
+    return value == 0 ? 0 : 64 - (size_t) __builtin_clzll(value);
+#endif
+  }
+
+  /**
+   * @brief bitwidth of a block parameter: number of used bits, at least one bit
+   * (the block of zeros is encoded with one bit per value). Signed values are interpreted as unsigned values of the same width.
+   *
+   * @tparam T  integer datatype of 8, 16, 32 or 64 bits
+   */
+  template <typename T>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t blockBitwidth(const T value) {
+    const size_t bits = usedBits((uint64_t) (typename std::make_unsigned<T>::type) value);
+    return bits == 0 ? 1 : bits;
+  }
+
+  /**
+   * @brief Reductions of a block of count values (OR, minimum, maximum) for all integer datatypes.
+   * With a SIMD register (see SimdRegister.h), whole registers are combined lane-wise, the lanes of the result register
+   * are reduced at the end, and the remaining values are reduced with a scalar loop.
+   *
+   * @tparam base_t  datatype of the values
+   */
+  template <typename base_t>
+  struct Reduction {
+#if LCTL_SIMDREGISTER_BYTES > 0
+    using simd_t = SimdRegister<LCTL_SIMDREGISTER_BYTES>;
+    using lanes_t = SimdLanes<LCTL_SIMDREGISTER_BYTES, sizeof(base_t)>;
+    using register_t = typename simd_t::register_t;
+    static constexpr size_t lanes = LCTL_SIMDREGISTER_BYTES / sizeof(base_t);
+    /* lane-wise unsigned minimum and maximum are not applicable for signed datatypes */
+    static constexpr bool vectorized = lanes_t::minmax && std::is_unsigned<base_t>::value;
+#endif
+
+    /**
+     * @brief bitwise or of all values, its number of used bits is the bitwidth of the maximum
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t orReduce(const base_t * inBase, const size_t count) {
+      base_t ret = 0;
+      size_t i = 0;
+#if LCTL_SIMDREGISTER_BYTES > 0
+      if (count >= lanes) {
+        register_t accumulator = simd_t::zero();
+        for (; i + lanes <= count; i += lanes)
+          accumulator = simd_t::bitwiseOr(accumulator, simd_t::load(inBase + i));
+        base_t lane[lanes];
+        std::memcpy(lane, &accumulator, sizeof(register_t));
+        for (size_t l = 0; l < lanes; l++)
+          ret |= lane[l];
+      }
+#endif
+      for (; i < count; i++)
+        ret |= inBase[i];
+      return ret;
+    }
+
+    /**
+     * @brief maximum of all values (count > 0)
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t maxReduce(const base_t * inBase, const size_t count) {
+      base_t ret = inBase[0];
+      size_t i = 0;
+#if LCTL_SIMDREGISTER_BYTES > 0
+      if (vectorized && count >= lanes) {
+        register_t accumulator = simd_t::load(inBase);
+        for (i = lanes; i + lanes <= count; i += lanes)
+          accumulator = lanes_t::max(accumulator, simd_t::load(inBase + i));
+        base_t lane[lanes];
+        std::memcpy(lane, &accumulator, sizeof(register_t));
+        for (size_t l = 0; l < lanes; l++)
+          ret = lane[l] > ret ? lane[l] : ret;
+      }
+#endif
+      for (; i < count; i++)
+        ret = inBase[i] > ret ? inBase[i] : ret;
+      return ret;
+    }
+
+    /**
+     * @brief minimum of all values (count > 0)
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t minReduce(const base_t * inBase, const size_t count) {
+      base_t ret = inBase[0];
+      size_t i = 0;
+#if LCTL_SIMDREGISTER_BYTES > 0
+      if (vectorized && count >= lanes) {
+        register_t accumulator = simd_t::load(inBase);
+        for (i = lanes; i + lanes <= count; i += lanes)
+          accumulator = lanes_t::min(accumulator, simd_t::load(inBase + i));
+        base_t lane[lanes];
+        std::memcpy(lane, &accumulator, sizeof(register_t));
+        for (size_t l = 0; l < lanes; l++)
+          ret = lane[l] < ret ? lane[l] : ret;
+      }
+#endif
+      for (; i < count; i++)
+        ret = inBase[i] < ret ? inBase[i] : ret;
+      return ret;
+    }
+  };
+
+}
+#endif /* LCTL_CODEGENERATION_REDUCTION_H */
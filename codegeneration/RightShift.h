@@ -364,9 +364,10 @@ namespace LCTL {
 #if LCTL_VERBOSEDECOMPRESSIONCODE
           std::cout << "  *outBase = (";
 #endif 
-          *outBase = (*inBase >> bits) % ( (compressedbase_t) 1ULL << (((bitsize_t-1) % (sizeof(base_t)*8))+1));
+          /* bitwidths larger than the output datatype (i.e. Simple-8b) are masked with the size of the output datatype */
+          *outBase = (*inBase >> bits) % ( (compressedbase_t) 1ULL << (bitsize_t < sizeof(base_t)*8 ? bitsize_t : sizeof(base_t)*8));
 #if LCTL_VERBOSEDECOMPRESSIONCODE
-          std::cout << (uint64_t) *inBase << " >> " << bits << ") % ( (compressedbase_t) 1ULL << (((" << bitsize_t-1 << ") % (sizeof(base_t)*8))+1));\n";
+          std::cout << (uint64_t) *inBase << " >> " << bits << ") % ( (compressedbase_t) 1ULL << " << (bitsize_t < sizeof(base_t)*8 ? bitsize_t : sizeof(base_t)*8) << ");\n";
 #endif
       };
   };
@@ -0,0 +1,66 @@
+/*
+ * File:   RunLength.h
+ */
+
+#ifndef LCTL_CODEGENERATION_RUNLENGTH_H
+#define LCTL_CODEGENERATION_RUNLENGTH_H
+
+#include "../Definitions.h"
+#include "./SimdRegister.h"
+#include <cstdint>
+#include <cstring>
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  /**
+   * @brief Number of equal values at the beginning of inBase, at most maxLength (maxLength > 0).
+   * With a SIMD register (see SimdRegister.h), a whole register is compared bytewise with the broadcasted first value,
+   * the first differing byte is found with a movemask and a count trailing zeros.
+   *
+   * @tparam base_t  datatype of the input column
+   */
+  template <typename base_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t findRunLength(const base_t * inBase, const size_t maxLength) {
+    const base_t value = *inBase;
+    size_t length = 1;
+#if LCTL_SIMDREGISTER_BYTES > 0
+    using simd_t = SimdRegister<LCTL_SIMDREGISTER_BYTES>;
+    constexpr size_t lanes = LCTL_SIMDREGISTER_BYTES / sizeof(base_t);
+    const typename simd_t::register_t pattern = broadcast<LCTL_SIMDREGISTER_BYTES>(value);
+    for (; length + lanes <= maxLength; length += lanes) {
+      const uint32_t mismatch = simd_t::mismatch(simd_t::load(inBase + length), pattern);
+      if (mismatch != 0)
+        return length + __builtin_ctz(mismatch) / sizeof(base_t);
+    }
+#endif
+    while (length < maxLength && inBase[length] == value)
+      length++;
+    return length;
+  }
+
+  /**
+   * @brief Writes length copies of value to outBase, memset for one byte values, broadcast stores otherwise
+   *
+   * @tparam base_t  datatype of the output column
+   */
+  template <typename base_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static void fillRun(base_t * outBase, const base_t value, const size_t length) {
+    if (sizeof(base_t) == 1) {
+      std::memset(outBase, (int) value, length);
+      return;
+    }
+    size_t i = 0;
+#if LCTL_SIMDREGISTER_BYTES > 0
+    using simd_t = SimdRegister<LCTL_SIMDREGISTER_BYTES>;
+    constexpr size_t lanes = LCTL_SIMDREGISTER_BYTES / sizeof(base_t);
+    const typename simd_t::register_t pattern = broadcast<LCTL_SIMDREGISTER_BYTES>(value);
+    for (; i + lanes <= length; i += lanes)
+      simd_t::store(outBase + i, pattern);
+#endif
+    for (; i < length; i++)
+      outBase[i] = value;
+  }
+
+}
+#endif /* LCTL_CODEGENERATION_RUNLENGTH_H */
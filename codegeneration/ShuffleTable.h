@@ -0,0 +1,116 @@
+/*
+ * File:   ShuffleTable.h
+ */
+
+#ifndef LCTL_CODEGENERATION_SHUFFLETABLE_H
+#define LCTL_CODEGENERATION_SHUFFLETABLE_H
+
+#include "../Definitions.h"
+#include <cstdint>
+#include <cstring>
+#include <header/preprocessor.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+namespace LCTL {
+  /**
+   * @brief Lookup tables for byte oriented formats with a descriptor byte of four 2 bit units
+   * (number of bytes minus one of each of four values, the first value in the lowest bits), i.e. VarintGB and Stream VByte.
+   * For each of the 256 descriptors, shuffle[descriptor] is the PSHUFB mask, which spreads the data bytes of the four values
+   * to four 32 bit lanes (0x80 zeroes a byte), and length[descriptor] is the number of data bytes.
+   */
+  struct GroupVarintTable {
+    uint8_t shuffle[256][16];
+    uint8_t length[256];
+
+    constexpr GroupVarintTable() : shuffle(), length() {
+      for (size_t descriptor = 0; descriptor < 256; descriptor++) {
+        uint8_t byte = 0;
+        for (size_t value = 0; value < 4; value++) {
+          const size_t bytes = ((descriptor >> (2 * value)) & 3) + 1;
+          for (size_t b = 0; b < 4; b++)
+            shuffle[descriptor][4 * value + b] = (b < bytes) ? byte++ : 0x80;
+        }
+        length[descriptor] = byte;
+      }
+    }
+  };
+
+  /* one table for all formats */
+  static constexpr GroupVarintTable groupVarintTable{};
+
+  /**
+   * @brief number of bytes minus one, which are needed to store value (at least one byte)
+   */
+  template <typename base_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint8_t byteUnits(const base_t value) {
+    return (uint8_t) ((value > 0xFF) + (value > 0xFFFF) + (value > 0xFFFFFF));
+  }
+
+  /**
+   * @brief Encodes four values, the descriptor byte is returned and the data bytes are written to data
+   */
+  template <typename base_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint8_t encodeGroupVarint(const base_t * in, uint8_t * & data) {
+    uint8_t descriptor = 0;
+    for (size_t value = 0; value < 4; value++) {
+      const uint32_t token = (uint32_t) in[value];
+      const uint8_t units = byteUnits(token);
+      descriptor |= units << (2 * value);
+      /* little endian: the lowest bytes are written */
+      std::memcpy(data, &token, units + 1);
+      data += units + 1;
+    }
+    return descriptor;
+  }
+
+  /**
+   * @brief Decodes four values with the data bytes in data and the descriptor byte, scalar case
+   */
+  template <typename base_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decodeGroupVarint(const uint8_t descriptor, const uint8_t * & data, base_t * out) {
+    for (size_t value = 0; value < 4; value++) {
+      const size_t bytes = ((descriptor >> (2 * value)) & 3) + 1;
+      uint32_t token = 0;
+      std::memcpy(&token, data, bytes);
+      out[value] = (base_t) token;
+      data += bytes;
+    }
+  }
+
+  /**
+   * @brief Fastest available decoder for four values, scalar case
+   *
+   * @tparam base_t  datatype of decompressed values
+   */
+  template <typename base_t>
+  struct DecodeGroupVarint {
+    /* number of bytes, which are read behind the data bytes of a group */
+    static constexpr size_t overread = 0;
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(const uint8_t descriptor, const uint8_t * & data, base_t * out) {
+      decodeGroupVarint(descriptor, data, out);
+    }
+  };
+
+#if defined(__SSSE3__)
+  /**
+   * @brief Decodes four 32 bit values with one unaligned 16 byte load and one PSHUFB.
+   * Up to 12 bytes behind the data bytes of the group are read.
+   */
+  template <>
+  struct DecodeGroupVarint<uint32_t> {
+    static constexpr size_t overread = 12;
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(const uint8_t descriptor, const uint8_t * & data, uint32_t * out) {
+      const __m128i bytes = _mm_loadu_si128((const __m128i *) data);
+      const __m128i mask = _mm_loadu_si128((const __m128i *) groupVarintTable.shuffle[descriptor]);
+      _mm_storeu_si128((__m128i *) out, _mm_shuffle_epi8(bytes, mask));
+      data += groupVarintTable.length[descriptor];
+    }
+  };
+#endif
+}
+#endif /* LCTL_CODEGENERATION_SHUFFLETABLE_H */
@@ -0,0 +1,208 @@
+/*
+ * File:   SimdRegister.h
+ */
+
+#ifndef LCTL_CODEGENERATION_SIMDREGISTER_H
+#define LCTL_CODEGENERATION_SIMDREGISTER_H
+
+#include "../Definitions.h"
+#include <cstdint>
+#include <cstring>
+#include <header/preprocessor.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Number of bytes of the widest integer register of the target, which is used by the helpers of
+ * RunLength.h (run detection), PrefixSum.h (delta decoding) and Reduction.h (block parameters).
+ * 0 means, that there is no SIMD register and the helpers use their scalar loops.
+ * This is the only place with a distinction of instruction sets for these helpers.
+ */
+#if defined(__AVX2__)
+# define LCTL_SIMDREGISTER_BYTES 32
+#elif defined(__SSE2__)
+# define LCTL_SIMDREGISTER_BYTES 16
+#else
+# define LCTL_SIMDREGISTER_BYTES 0
+#endif
+
+namespace LCTL {
+
+  /**
+   * @brief integer register with bytes_t bytes: load, store, broadcast, bitwise or, bytewise comparison
+   * and a shift by whole bytes within 128 bit lanes
+   *
+   * @tparam bytes_t  16 (SSE2) or 32 (AVX2)
+   */
+  template <size_t bytes_t>
+  struct SimdRegister {};
+
+  /**
+   * @brief lane-wise operations of a register with bytes_t bytes and lanes of lanesize_t bytes.
+   * minmax is true, if there is a lane-wise unsigned minimum and maximum: SSE2 has only unsigned 8 bit lanes,
+   * SSE4.1 adds 16 and 32 bit lanes, AVX2 all of them in 256 bit registers.
+   * 64 bit lanes have no unsigned minimum and maximum before AVX-512.
+   *
+   * @tparam bytes_t     16 (SSE2) or 32 (AVX2)
+   * @tparam lanesize_t  1, 2, 4 or 8
+   */
+  template <size_t bytes_t, size_t lanesize_t>
+  struct SimdLanes {
+    static constexpr bool minmax = false;
+  };
+
+#if LCTL_SIMDREGISTER_BYTES >= 16
+  template <>
+  struct SimdRegister<16> {
+    using register_t = __m128i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t load(const void * address) { return _mm_loadu_si128((const __m128i *) address); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void store(void * address, const register_t value) { _mm_storeu_si128((__m128i *) address, value); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t zero() { return _mm_setzero_si128(); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t bitwiseOr(const register_t a, const register_t b) { return _mm_or_si128(a, b); }
+    /* one bit per byte, set for bytes which differ */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint32_t mismatch(const register_t a, const register_t b) {
+      return (uint32_t) (~_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) & 0xFFFF);
+    }
+    template <size_t shift_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t shiftLeftBytes(const register_t value) { return _mm_slli_si128(value, shift_t); }
+  };
+
+  template <>
+  struct SimdLanes<16, 1> {
+    static constexpr bool minmax = true;
+    using register_t = __m128i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t add(const register_t a, const register_t b) { return _mm_add_epi8(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return _mm_min_epu8(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return _mm_max_epu8(a, b); }
+  };
+
+  template <>
+  struct SimdLanes<16, 2> {
+# if defined(__SSE4_1__)
+    static constexpr bool minmax = true;
+# else
+    static constexpr bool minmax = false;
+# endif
+    using register_t = __m128i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t add(const register_t a, const register_t b) { return _mm_add_epi16(a, b); }
+# if defined(__SSE4_1__)
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return _mm_min_epu16(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return _mm_max_epu16(a, b); }
+# else
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return a; }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return a; }
+# endif
+  };
+
+  template <>
+  struct SimdLanes<16, 4> {
+# if defined(__SSE4_1__)
+    static constexpr bool minmax = true;
+# else
+    static constexpr bool minmax = false;
+# endif
+    using register_t = __m128i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t add(const register_t a, const register_t b) { return _mm_add_epi32(a, b); }
+# if defined(__SSE4_1__)
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return _mm_min_epu32(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return _mm_max_epu32(a, b); }
+# else
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return a; }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return a; }
+# endif
+  };
+
+  template <>
+  struct SimdLanes<16, 8> {
+    static constexpr bool minmax = false;
+    using register_t = __m128i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t add(const register_t a, const register_t b) { return _mm_add_epi64(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return a; }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return a; }
+  };
+#endif
+
+#if LCTL_SIMDREGISTER_BYTES >= 32
+  template <>
+  struct SimdRegister<32> {
+    using register_t = __m256i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t load(const void * address) { return _mm256_loadu_si256((const __m256i *) address); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void store(void * address, const register_t value) { _mm256_storeu_si256((__m256i *) address, value); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t zero() { return _mm256_setzero_si256(); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t bitwiseOr(const register_t a, const register_t b) { return _mm256_or_si256(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint32_t mismatch(const register_t a, const register_t b) {
+      return (uint32_t) ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b));
+    }
+    template <size_t shift_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t shiftLeftBytes(const register_t value) { return _mm256_slli_si256(value, shift_t); }
+  };
+
+  template <>
+  struct SimdLanes<32, 1> {
+    static constexpr bool minmax = true;
+    using register_t = __m256i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t add(const register_t a, const register_t b) { return _mm256_add_epi8(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return _mm256_min_epu8(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return _mm256_max_epu8(a, b); }
+  };
+
+  template <>
+  struct SimdLanes<32, 2> {
+    static constexpr bool minmax = true;
+    using register_t = __m256i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t add(const register_t a, const register_t b) { return _mm256_add_epi16(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return _mm256_min_epu16(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return _mm256_max_epu16(a, b); }
+  };
+
+  template <>
+  struct SimdLanes<32, 4> {
+    static constexpr bool minmax = true;
+    using register_t = __m256i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t add(const register_t a, const register_t b) { return _mm256_add_epi32(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return _mm256_min_epu32(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return _mm256_max_epu32(a, b); }
+  };
+
+  template <>
+  struct SimdLanes<32, 8> {
+    static constexpr bool minmax = false;
+    using register_t = __m256i;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t add(const register_t a, const register_t b) { return _mm256_add_epi64(a, b); }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t min(const register_t a, const register_t b) { return a; }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static register_t max(const register_t a, const register_t b) { return a; }
+  };
+#endif
+
+#if LCTL_SIMDREGISTER_BYTES > 0
+  /**
+   * @brief register with value in each lane of sizeof(base_t) bytes (the compiler generates a broadcast instruction)
+   */
+  template <size_t bytes_t, typename base_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static typename SimdRegister<bytes_t>::register_t broadcast(const base_t value) {
+    base_t lanes[bytes_t / sizeof(base_t)];
+    for (size_t i = 0; i < bytes_t / sizeof(base_t); i++)
+      lanes[i] = value;
+    typename SimdRegister<bytes_t>::register_t ret;
+    std::memcpy(&ret, lanes, bytes_t);
+    return ret;
+  }
+
+  /**
+   * @brief 128 bit register with the highest lane of value in each lane
+   */
+  template <typename base_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static __m128i broadcastLastLane(const __m128i value) {
+    if (sizeof(base_t) == 4)
+      return _mm_shuffle_epi32(value, 0xFF);
+    if (sizeof(base_t) == 8)
+      return _mm_shuffle_epi32(value, 0xEE);
+    base_t lanes[16 / sizeof(base_t)];
+    std::memcpy(lanes, &value, 16);
+    return broadcast<16, base_t>(lanes[16 / sizeof(base_t) - 1]);
+  }
+#endif
+}
+#endif /* LCTL_CODEGENERATION_SIMDREGISTER_H */
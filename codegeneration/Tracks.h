@@ -0,0 +1,106 @@
+/*
+ * File:   Tracks.h
+ */
+
+#ifndef LCTL_CODEGENERATION_TRACKS_H
+#define LCTL_CODEGENERATION_TRACKS_H
+
+#include "../Definitions.h"
+#include "../language/calculation/Concat.h"
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+namespace LCTL {
+  /**
+   * @brief Current position in the descriptor track of a format with a Tracks-combiner.
+   * The data track is the usual outBase (compression) or inBase (decompression).
+   * A pointer to a DescriptorTrack is the last element of the runtime parameter tuple,
+   * thus the positions of all runtime parameters calculated in the analyzer stay the same.
+   *
+   * @tparam compressedbase_t  datatype of the compressed words, const in the decompression direction
+   */
+  template <typename compressedbase_t>
+  struct DescriptorTrack {
+    compressedbase_t * base;
+  };
+
+  template <typename T>
+  struct IsDescriptorTrack : std::false_type {};
+
+  template <typename compressedbase_t>
+  struct IsDescriptorTrack<DescriptorTrack<compressedbase_t> *> : std::true_type {};
+
+  /* true, iff the last element of the runtime parameter tuple is a descriptor track */
+  template <typename tuple_t>
+  struct EndsWithDescriptorTrack : std::false_type {};
+
+  template <typename first_t, typename... parameters_t>
+  struct EndsWithDescriptorTrack<std::tuple<first_t, parameters_t...>>
+    : IsDescriptorTrack<typename std::tuple_element<sizeof...(parameters_t), std::tuple<first_t, parameters_t...>>::type> {};
+
+  /**
+   * @brief appends a new runtime parameter to the runtime parameter tuple.
+   * If the last element is a descriptor track, the new parameter is inserted in front of it.
+   */
+  template <typename tuple_t, typename = void>
+  struct AppendParameter {
+    template <typename parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static auto apply(const tuple_t parameters, parameter_t * parameter)
+      -> decltype(std::tuple_cat(parameters, std::make_tuple(parameter)))
+    {
+      return std::tuple_cat(parameters, std::make_tuple(parameter));
+    }
+  };
+
+  template <typename... parameters_t>
+  struct AppendParameter<
+    std::tuple<parameters_t...>,
+    typename std::enable_if<EndsWithDescriptorTrack<std::tuple<parameters_t...>>::value>::type
+  >{
+    using tuple_t = std::tuple<parameters_t...>;
+    using track_t = typename std::tuple_element<sizeof...(parameters_t) - 1, tuple_t>::type;
+
+    template <typename parameter_t, size_t... index_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static auto insert(
+      const tuple_t parameters,
+      parameter_t * parameter,
+      std::index_sequence<index_t...>)
+    {
+      return std::make_tuple(std::get<index_t>(parameters)..., parameter, std::get<sizeof...(parameters_t) - 1>(parameters));
+    }
+
+    template <typename parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static auto apply(const tuple_t parameters, parameter_t * parameter)
+    {
+      return insert(parameters, parameter, std::make_index_sequence<sizeof...(parameters_t) - 1>());
+    }
+  };
+
+  template <typename parameter_t, typename... parameters_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE auto appendParameter(const std::tuple<parameters_t...> parameters, parameter_t * parameter)
+  {
+    return AppendParameter<std::tuple<parameters_t...>>::apply(parameters, parameter);
+  }
+
+  /**
+   * @brief position of the last calculated runtime parameter in the runtime parameter tuple,
+   * the descriptor track is skipped
+   */
+  template <typename tuple_t>
+  struct LastParameter : std::integral_constant<
+    size_t,
+    std::tuple_size<tuple_t>::value - 1 - (EndsWithDescriptorTrack<tuple_t>::value ? 1 : 0)
+  > {};
+
+  /**
+   * @brief number of bits of all elements of an analyzed concat combine function (tuples of name, logical value and number of bits)
+   */
+  template <typename concat_t>
+  struct ConcatBits : std::integral_constant<size_t, 0> {};
+
+  template <typename name_t, typename logical_t, typename bitstype_t, bitstype_t bits_t, typename... tail_t>
+  struct ConcatBits<Concat<std::tuple<name_t, logical_t, Value<bitstype_t, bits_t>>, tail_t...>>
+    : std::integral_constant<size_t, bits_t + ConcatBits<Concat<tail_t...>>::value> {};
+}
+#endif /* LCTL_CODEGENERATION_TRACKS_H */
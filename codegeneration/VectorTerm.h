@@ -0,0 +1,149 @@
+/*
+ * File:   VectorTerm.h
+ */
+
+#ifndef LCTL_CODEGENERATION_VECTORTERM_H
+#define LCTL_CODEGENERATION_VECTORTERM_H
+
+#include "../Definitions.h"
+#include "./ProcessingStyle.h"
+#include "../language/calculation/arithmetics.h"
+#include <header/preprocessor.h>
+#include <header/vector_extension_structs.h>
+#include <header/vector_primitives.h>
+
+namespace LCTL {
+  /**
+   * @brief Evaluation of a logical encoding term (or its inverse) for all lanes of a vector register at once.
+   * The vector token contains LaneCount<processingStyle_t> input values, one per lane.
+   *
+   * General case: the term has no vectorized counterpart (yet). The term is evaluated lane by lane
+   * with its scalar apply-function. This is always correct, but slow,
+   * and it is only used for terms without a specialization below.
+   *
+   * @tparam processingStyle_t  TVL Processing Style (sse, avx2, avx512)
+   * @tparam term_t             logical encoding term, i.e. Token, Minus<Token, Value<uint32_t, 5>>
+   */
+  template <class processingStyle_t, typename term_t>
+  struct VectorTerm {
+    using base_t = typename processingStyle_t::base_t;
+    using vector_t = typename processingStyle_t::vector_t;
+
+    /**
+     * @tparam parameters_t datatypes of runtime parameters
+     * @param token         LaneCount<processingStyle_t> tokens in one vector register
+     * @param parameter     runtime parameters
+     * @return              vector register with the evaluated term for each lane
+     */
+    template <typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static vector_t apply(
+      const vector_t token,
+      const std::tuple<parameters_t...> parameter)
+    {
+      base_t lanes[LaneCount<processingStyle_t>::value];
+      base_t result[LaneCount<processingStyle_t>::value];
+      vectorlib::store<processingStyle_t, vectorlib::iov::UNALIGNED, processingStyle_t::vector_helper_t::size_bit::value>(lanes, token);
+      for (size_t i = 0; i < LaneCount<processingStyle_t>::value; i++) {
+        const base_t * lane = lanes + i;
+        result[i] = (base_t) term_t::apply(lane, 1, parameter);
+      }
+      return vectorlib::load<processingStyle_t, vectorlib::iov::UNALIGNED, processingStyle_t::vector_helper_t::size_bit::value>(result);
+    }
+  };
+
+  /**
+   * @brief no logical encoding, tokens are written as they are
+   */
+  template <class processingStyle_t>
+  struct VectorTerm<processingStyle_t, Token> {
+    using vector_t = typename processingStyle_t::vector_t;
+
+    template <typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static vector_t apply(
+      const vector_t token,
+      const std::tuple<parameters_t...> parameter)
+    {
+#     if LCTL_VERBOSECODE
+        std::cout << "token";
+#     endif
+      return token;
+    }
+  };
+
+  /**
+   * @brief compiletime known value, broadcasted to all lanes
+   */
+  template <class processingStyle_t, typename T, T value_t>
+  struct VectorTerm<processingStyle_t, Value<T, value_t>> {
+    using base_t = typename processingStyle_t::base_t;
+    using vector_t = typename processingStyle_t::vector_t;
+
+    template <typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static vector_t apply(
+      const vector_t token,
+      const std::tuple<parameters_t...> parameter)
+    {
+#     if LCTL_VERBOSECODE
+        std::cout << "set1(" << (uint64_t) value_t << ")";
+#     endif
+      return vectorlib::set1<processingStyle_t, processingStyle_t::vector_helper_t::granularity::value>((base_t) value_t);
+    }
+  };
+
+  /**
+   * @brief runtime parameter (one value per block), broadcasted to all lanes
+   */
+  template <class processingStyle_t, typename name_t, size_t position_t>
+  struct VectorTerm<processingStyle_t, StringIR<name_t, position_t>> {
+    using base_t = typename processingStyle_t::base_t;
+    using vector_t = typename processingStyle_t::vector_t;
+
+    template <typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static vector_t apply(
+      const vector_t token,
+      const std::tuple<parameters_t...> parameter)
+    {
+#     if LCTL_VERBOSECODE
+        std::cout << "set1(" << (uint64_t) *std::get<position_t>(parameter) << ")";
+#     endif
+      return vectorlib::set1<processingStyle_t, processingStyle_t::vector_helper_t::granularity::value>((base_t) *std::get<position_t>(parameter));
+    }
+  };
+
+  /**
+   * @brief lane-wise subtraction, i.e. frame of reference
+   */
+  template <class processingStyle_t, typename T, typename U>
+  struct VectorTerm<processingStyle_t, Minus<T, U>> {
+    using vector_t = typename processingStyle_t::vector_t;
+
+    template <typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static vector_t apply(
+      const vector_t token,
+      const std::tuple<parameters_t...> parameter)
+    {
+      return vectorlib::sub<processingStyle_t, processingStyle_t::vector_helper_t::granularity::value>::apply(
+        VectorTerm<processingStyle_t, T>::apply(token, parameter),
+        VectorTerm<processingStyle_t, U>::apply(token, parameter));
+    }
+  };
+
+  /**
+   * @brief lane-wise addition, i.e. inverse of frame of reference
+   */
+  template <class processingStyle_t, typename T, typename U>
+  struct VectorTerm<processingStyle_t, Plus<T, U>> {
+    using vector_t = typename processingStyle_t::vector_t;
+
+    template <typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static vector_t apply(
+      const vector_t token,
+      const std::tuple<parameters_t...> parameter)
+    {
+      return vectorlib::add<processingStyle_t, processingStyle_t::vector_helper_t::granularity::value>::apply(
+        VectorTerm<processingStyle_t, T>::apply(token, parameter),
+        VectorTerm<processingStyle_t, U>::apply(token, parameter));
+    }
+  };
+}
+#endif /* LCTL_CODEGENERATION_VECTORTERM_H */
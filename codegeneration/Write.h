@@ -10,6 +10,7 @@
 #include "./LeftShift.h"
 #include "./RightShift.h"
 #include "./Increment.h"
+#include "./ProcessingStyle.h"
 
 #ifndef LCTL_CODEGENERATION_WRITE_H
 #define LCTL_CODEGENERATION_WRITE_H
@@ -54,10 +55,9 @@ namespace LCTL {
         if ((bitposition_t + bitwidth_t) >= sizeof(compressedbase_t)*8) std::cout << "  outBase";
 #     endif
         
-      Incr<
+      IncrVector<
         ((bitposition_t + bitwidth_t) >= (overhangWordCounter_t+1)*sizeof(compressedbase_t)*8),
-        compressedbase_t, 
-        processingStyle_t::size::value / processingStyle_t::vector_helper_t::size_byte::value
+        processingStyle_t
       >::apply(outBase);
       
 #     if LCTL_VERBOSECOMPRESSIONCODE
@@ -112,10 +112,9 @@ namespace LCTL {
 #     endif
         
       /* Increment inBase if needed */
-      Incr<
-        (bitposition_t + bitwidth_t >= (overhangWordCounter_t+1) * sizeof(compressedbase_t) * 8 ), 
-        compressedbase_t, 
-        processingStyle_t::size::value / processingStyle_t::vector_helper_t::size_byte::value
+      IncrVector<
+        (bitposition_t + bitwidth_t >= (overhangWordCounter_t+1) * sizeof(compressedbase_t) * 8 ),
+        processingStyle_t
       >::apply(inBase);
       
       LeftShift<
@@ -194,10 +193,10 @@ namespace LCTL {
         if ((bitposition_t + bitwidth_t) >= (maxOverhangWordCounter_t+1)*sizeof(compressedbase_t)*8) std::cout << "  outBase";
 #     endif
         
-      Incr<
-        ((bitposition_t + bitwidth_t) == (maxOverhangWordCounter_t+1)*sizeof(compressedbase_t)*8), 
-        compressedbase_t, 
-        processingStyle_t::size::value / processingStyle_t::vector_helper_t::size_byte::value>::apply(outBase);
+      IncrVector<
+        ((bitposition_t + bitwidth_t) == (maxOverhangWordCounter_t+1)*sizeof(compressedbase_t)*8),
+        processingStyle_t
+      >::apply(outBase);
       
       return;
     }
@@ -213,10 +212,9 @@ namespace LCTL {
         if ((bitposition_t + bitwidth_t) >= (maxOverhangWordCounter_t+1)*sizeof(compressedbase_t)*8) std::cout << "  inBase";
 #     endif
         
-      Incr<
-        ((bitposition_t + bitwidth_t) == (maxOverhangWordCounter_t+1)*sizeof(compressedbase_t)*8), 
-        compressedbase_t, 
-        processingStyle_t::size::value / processingStyle_t::vector_helper_t::size_byte::value
+      IncrVector<
+        ((bitposition_t + bitwidth_t) == (maxOverhangWordCounter_t+1)*sizeof(compressedbase_t)*8),
+        processingStyle_t
       >::apply(inBase);
       
       return;
@@ -237,6 +235,7 @@ namespace LCTL {
    * @tparam bitwidth_t           bitwidth of value to encode
    * @tparam logicalencoding_t    eventualy logical preprocessing
    * @tparam tokensize_t>          number of uncompressed input values (or decompressed output values) (- at the moment exactly one value)
+   * @tparam isVectorized_t       SIMD processing styles are handled in WriteVertical.h
    * 
    * @date: 31.05.2021 12:00
    * @author: Juliana Hildebrandt
@@ -249,7 +248,8 @@ namespace LCTL {
     size_t bitwidth_t,
     typename logicalencoding_t,
     size_t tokensize_t,
-    bool doOrDont = true
+    bool doOrDont = true,
+    bool isVectorized_t = IsVectorized<processingStyle_t>::value
   >
   struct Write{
     using compressedbase_t = typename processingStyle_t::base_t;
@@ -374,7 +374,8 @@ namespace LCTL {
           bitwidth_t, 
           Token, 
           tokensize_t,
-          doOrDont
+          doOrDont,
+          false
   >{
     using compressedbase_t = typename processingStyle_t::base_t;
 
@@ -459,7 +460,8 @@ namespace LCTL {
     typename base_t,
     base_t value_t,
     size_t bitposition_t, 
-    size_t bitwidth_t
+    size_t bitwidth_t,
+    bool isVectorized_t = IsVectorized<processingStyle_t>::value
   >
   struct WriteFix{
       using compressedbase_t = typename processingStyle_t::base_t;
@@ -0,0 +1,242 @@
+/*
+ * File:   WriteVertical.h
+ */
+
+#ifndef LCTL_CODEGENERATION_WRITEVERTICAL_H
+#define LCTL_CODEGENERATION_WRITEVERTICAL_H
+
+#include "../Definitions.h"
+#include "./ProcessingStyle.h"
+#include "./VectorTerm.h"
+#include "./Increment.h"
+#include "./Write.h"
+#include <header/preprocessor.h>
+#include <header/vector_extension_structs.h>
+#include <header/vector_primitives.h>
+
+namespace LCTL {
+  /**
+   * @brief Lane-wise right shift of the concatenation hi:lo, i.e. (lo >> shift_t) | (hi << (wordsize - shift_t)).
+   * Used to reassemble span values, whose lower bits are at the end of the register lo
+   * and whose higher bits are at the beginning of the next register hi.
+   * General case with two shifts and one bitwise or; processing styles with a funnel shift instruction
+   * specialize this template (see WriteVerticalAVX512.h).
+   *
+   * @tparam processingStyle_t  TVL Processing Style (sse, avx2, avx512)
+   * @tparam shift_t            number of bits to shift, 0 < shift_t < wordsize
+   */
+  template <class processingStyle_t, size_t shift_t>
+  struct ShiftRightConcat {
+    using vector_t = typename processingStyle_t::vector_t;
+    static constexpr size_t wordsize = sizeof(typename processingStyle_t::base_t) * 8;
+    static constexpr size_t granularity = processingStyle_t::vector_helper_t::granularity::value;
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static vector_t apply(const vector_t lo, const vector_t hi){
+      return vectorlib::bitwise_or<processingStyle_t>(
+        vectorlib::shift_right<processingStyle_t, granularity>::apply(lo, shift_t),
+        vectorlib::shift_left<processingStyle_t, granularity>::apply(hi, (wordsize - shift_t) % wordsize));
+    }
+  };
+
+  /**
+   * @brief Writes/reads one vector register of encoded values in a vertical layout.
+   * Each lane is a bitstream of its own. The bitposition and the bitwidth are the same for all lanes,
+   * thus the scalar bit-level logic is kept and each statement works on LaneCount values at once:
+   * leftshift and bitwise or into the current output register,
+   * write the overhang rightshifted to the next output register.
+   * In contrast to the scalar case, input and compressed datatype are the same
+   * (see static_assert in ColumnFormat), so a value spans at most two registers.
+   *
+   * @tparam processingStyle_t  TVL Processing Style (sse, avx2, avx512)
+   * @tparam bitposition_t      next value to encode starts at bitposition (in each lane)
+   * @tparam bitwidth_t         bitwidth of value to encode
+   */
+  template <
+    class processingStyle_t,
+    size_t bitposition_t,
+    size_t bitwidth_t
+  >
+  struct WriteVector {
+    using compressedbase_t = typename processingStyle_t::base_t;
+    using vector_t = typename processingStyle_t::vector_t;
+    static constexpr size_t wordsize = sizeof(compressedbase_t) * 8;
+    static constexpr size_t vectorsize = processingStyle_t::vector_helper_t::size_bit::value;
+    static constexpr size_t granularity = processingStyle_t::vector_helper_t::granularity::value;
+
+    /**
+     * @param token     LaneCount encoded values, one per lane
+     * @param outBase   memory region for compressed output data
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(
+      const vector_t token,
+      compressedbase_t * & outBase)
+    {
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        if (bitposition_t == 0) std::cout << "  store(outBase, token);\n";
+        else std::cout << "  store(outBase, or(load(outBase), shift_left(token, " << bitposition_t << ")));\n";
+#     endif
+      if (bitposition_t == 0)
+        vectorlib::store<processingStyle_t, vectorlib::iov::UNALIGNED, vectorsize>(outBase, token);
+      else
+        vectorlib::store<processingStyle_t, vectorlib::iov::UNALIGNED, vectorsize>(
+          outBase,
+          vectorlib::bitwise_or<processingStyle_t>(
+            vectorlib::load<processingStyle_t, vectorlib::iov::UNALIGNED, vectorsize>(outBase),
+            vectorlib::shift_left<processingStyle_t, granularity>::apply(token, bitposition_t % wordsize)));
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        if (bitposition_t + bitwidth_t >= wordsize) std::cout << "  outBase";
+#     endif
+      IncrVector<(bitposition_t + bitwidth_t >= wordsize), processingStyle_t>::apply(outBase);
+      /* span value: write the higher bits to the next register */
+      if (bitposition_t + bitwidth_t > wordsize) {
+#       if LCTL_VERBOSECOMPRESSIONCODE
+          std::cout << "  store(outBase, shift_right(token, " << wordsize - bitposition_t << "));\n";
+#       endif
+        vectorlib::store<processingStyle_t, vectorlib::iov::UNALIGNED, vectorsize>(
+          outBase,
+          vectorlib::shift_right<processingStyle_t, granularity>::apply(token, (wordsize - bitposition_t) % wordsize));
+      }
+      return;
+    }
+
+    /**
+     * @param inBase    compressed input data
+     * @return          LaneCount decoded values (still logically encoded), one per lane
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static vector_t decompress(
+      const compressedbase_t * & inBase)
+    {
+      vector_t token = vectorlib::load<processingStyle_t, vectorlib::iov::UNALIGNED, vectorsize>(inBase);
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        if (bitposition_t + bitwidth_t >= wordsize) std::cout << "  inBase";
+#     endif
+      IncrVector<(bitposition_t + bitwidth_t >= wordsize), processingStyle_t>::apply(inBase);
+      /* span value: fetch the higher bits from the next register */
+      if (bitposition_t + bitwidth_t > wordsize) {
+#       if LCTL_VERBOSEDECOMPRESSIONCODE
+          std::cout << "  token = shift_right_concat(token, load(inBase), " << bitposition_t << ");\n";
+#       endif
+        token = ShiftRightConcat<processingStyle_t, bitposition_t % wordsize>::apply(
+          token,
+          vectorlib::load<processingStyle_t, vectorlib::iov::UNALIGNED, vectorsize>(inBase));
+      }
+      else if (bitposition_t != 0) {
+#       if LCTL_VERBOSEDECOMPRESSIONCODE
+          std::cout << "  token = shift_right(token, " << bitposition_t << ");\n";
+#       endif
+        token = vectorlib::shift_right<processingStyle_t, granularity>::apply(token, bitposition_t % wordsize);
+      }
+      if (bitwidth_t < wordsize) {
+#       if LCTL_VERBOSEDECOMPRESSIONCODE
+          std::cout << "  token = and(token, set1((1 << " << bitwidth_t << ") - 1));\n";
+#       endif
+        token = vectorlib::bitwise_and<processingStyle_t>(
+          token,
+          vectorlib::set1<processingStyle_t, granularity>((((compressedbase_t) 1) << (bitwidth_t % wordsize)) - 1));
+      }
+      return token;
+    }
+  };
+
+  /**
+   * @brief Write for SIMD processing styles (vertical layout).
+   * Encodes LaneCount tokens from inBase with the logical encoding and writes them to the output
+   * (compression direction) or reads LaneCount encoded values, decodes them and writes them
+   * to the decompressed output (decompression direction).
+   * The callers increase inBase (or outBase) by LaneCount values afterwards.
+   *
+   * @tparam processingStyle_t    TVL Processing Style, contains also datatype to handle the memory region of compressed and decompressed values
+   * @tparam base_t               datatype of input column; the same as base_t in processingStyle
+   * @tparam bitposition_t        next value to encode starts at bitposition
+   * @tparam bitwidth_t           bitwidth of value to encode
+   * @tparam logicalencoding_t    eventually logical preprocessing
+   * @tparam tokensize_t          number of uncompressed input values per lane (- at the moment exactly one value)
+   * @tparam doOrDont             not used
+   */
+  template <
+    class processingStyle_t,
+    typename base_t,
+    size_t bitposition_t,
+    size_t bitwidth_t,
+    typename logicalencoding_t,
+    size_t tokensize_t,
+    bool doOrDont
+  >
+  struct Write<
+    processingStyle_t,
+    base_t,
+    bitposition_t,
+    bitwidth_t,
+    logicalencoding_t,
+    tokensize_t,
+    doOrDont,
+    /* vectorized */
+    true
+  >{
+    using compressedbase_t = typename processingStyle_t::base_t;
+    static_assert(std::is_same<base_t, compressedbase_t>::value, "SIMD processing styles need the same input and compressed datatype");
+
+    template<typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(
+            const base_t * & inBase,
+            const size_t tokensize,
+            compressedbase_t * & outBase,
+            const std::tuple<parameters_t...> parameter)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tWrite<class processingStyle_t,base_t,bitposition_t,bitwidth_t,logicalencoding_t,tokensize_t,doOrDont,true>::compress(...)\n";
+#     endif
+      WriteVector<processingStyle_t, bitposition_t, bitwidth_t>::compress(
+        VectorTerm<processingStyle_t, logicalencoding_t>::apply(
+          vectorlib::load<processingStyle_t, vectorlib::iov::UNALIGNED, processingStyle_t::vector_helper_t::size_bit::value>(inBase),
+          parameter),
+        outBase);
+      return;
+    }
+
+    template<typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decompress(
+            const compressedbase_t * & inBase,
+            const size_t tokensize,
+            base_t * & outBase,
+            const std::tuple<parameters_t...> parameter)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tWrite<class processingStyle_t,base_t,bitposition_t,bitwidth_t,logicalencoding_t,tokensize_t,doOrDont,true>::decompress(...)\n";
+#     endif
+      vectorlib::store<processingStyle_t, vectorlib::iov::UNALIGNED, processingStyle_t::vector_helper_t::size_bit::value>(
+        outBase,
+        VectorTerm<processingStyle_t, typename logicalencoding_t::inverse>::apply(
+          WriteVector<processingStyle_t, bitposition_t, bitwidth_t>::decompress(inBase),
+          parameter));
+      return;
+    }
+  };
+
+  /**
+   * @brief WriteFix for SIMD processing styles: the compiletime known value is written to each lane.
+   */
+  template <
+    class processingStyle_t,
+    typename base_t,
+    base_t value_t,
+    size_t bitposition_t,
+    size_t bitwidth_t
+  >
+  struct WriteFix<processingStyle_t, base_t, value_t, bitposition_t, bitwidth_t, true>{
+    using compressedbase_t = typename processingStyle_t::base_t;
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(compressedbase_t * & outBase){
+      WriteVector<processingStyle_t, bitposition_t, bitwidth_t>::compress(
+        vectorlib::set1<processingStyle_t, processingStyle_t::vector_helper_t::granularity::value>((compressedbase_t) value_t),
+        outBase);
+      return;
+    }
+  };
+}
+
+#include "./WriteVerticalAVX512.h"
+
+#endif /* LCTL_CODEGENERATION_WRITEVERTICAL_H */
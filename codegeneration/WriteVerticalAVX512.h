@@ -0,0 +1,63 @@
+/*
+ * File:   WriteVerticalAVX512.h
+ */
+
+#ifndef LCTL_CODEGENERATION_WRITEVERTICALAVX512_H
+#define LCTL_CODEGENERATION_WRITEVERTICALAVX512_H
+
+#include "../Definitions.h"
+#include <header/preprocessor.h>
+#include <header/vector_extension_structs.h>
+#include <header/vector_primitives.h>
+
+/*
+ * VPERMB and VPMULTISHIFTQB (AVX-512 VBMI) unpack a horizontally packed bitstream, where consecutive values
+ * cross the lanes of a register. In the vertical layout of LCTL, each lane is a bitstream of its own,
+ * thus no byte permutation across lanes is necessary. The only decode step with more than one instruction per
+ * register is the reassembling of span values, which is done here with VPSHRD (AVX-512 VBMI2).
+ */
+#if defined(__AVX512VBMI2__)
+#include <immintrin.h>
+
+namespace LCTL {
+  /**
+   * @brief AVX-512 VBMI2: span values are reassembled with one concat-and-shift instruction (VPSHRD)
+   * instead of two shifts and a bitwise or. There is no 8 bit variant,
+   * avx512<v512<uint8_t>> uses the general case.
+   *
+   * @tparam shift_t  number of bits to shift, 0 < shift_t < 16
+   */
+  template <size_t shift_t>
+  struct ShiftRightConcat<vectorlib::avx512<vectorlib::v512<uint16_t>>, shift_t> {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static __m512i apply(const __m512i lo, const __m512i hi){
+      return _mm512_shrdi_epi16(lo, hi, shift_t);
+    }
+  };
+
+  /**
+   * @brief AVX-512 VBMI2, 32 bit lanes
+   *
+   * @tparam shift_t  number of bits to shift, 0 < shift_t < 32
+   */
+  template <size_t shift_t>
+  struct ShiftRightConcat<vectorlib::avx512<vectorlib::v512<uint32_t>>, shift_t> {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static __m512i apply(const __m512i lo, const __m512i hi){
+      return _mm512_shrdi_epi32(lo, hi, shift_t);
+    }
+  };
+
+  /**
+   * @brief AVX-512 VBMI2, 64 bit lanes
+   *
+   * @tparam shift_t  number of bits to shift, 0 < shift_t < 64
+   */
+  template <size_t shift_t>
+  struct ShiftRightConcat<vectorlib::avx512<vectorlib::v512<uint64_t>>, shift_t> {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static __m512i apply(const __m512i lo, const __m512i hi){
+      return _mm512_shrdi_epi64(lo, hi, shift_t);
+    }
+  };
+}
+#endif /* __AVX512VBMI2__ */
+
+#endif /* LCTL_CODEGENERATION_WRITEVERTICALAVX512_H */
@@ -19,6 +19,12 @@
 
 using namespace LCTL;
 
+/**
+ * @brief VarintGB (group varint): groups of four 32 bit values, each value is stored with the lowest 1, 2, 3 or 4 bytes.
+ * The number of bytes minus one of each value is a 2 bit unit, the four units of a group form one descriptor byte 
+ * in front of the data bytes of the group (the units of the first value in the lowest bits).
+ * Decompression uses a table of 256 shuffle masks indexed by the descriptor byte (PSHUFB, if SSSE3 is available).
+ */
 using varintgb =
   ColumnFormat<
     scalar<v8<uint8_t>>,
@@ -28,22 +34,18 @@ using varintgb =
       Loop<
         StaticTokenizer<1>,
         ParameterCalculator<
-          ParameterDefinition<
-            String<decltype("bitwidth"_tstr)>,
-            Times<Div<Plus<Bitwidth<Token>, Size<7>>, Size<8>>, Size<8>>, /* bw 1..8 -> 8, bw 9..15 -> 16, bw 16..24 -> 24, bw 25..32 -> 32 */
-            NIL /* braucht nicht kodiert werden */
-          >,
           ParameterDefinition<//stores all descriptor bits
             String<decltype("units"_tstr)>,
+            /* bw 0..8 -> 0, bw 9..16 -> 1, bw 17..24 -> 2, bw 25..32 -> 3 */
             Minus<
-              Div<String<decltype("bitwidth"_tstr)>, Size<8>>,
+              Div<Plus<Bitwidth<Token>, Size<7>>, Size<8>>,
               Size<1>
             >,
             Size<2/*bit*/>
           >
         >,
-        Encoder<Token, String<decltype("bitwidth"_tstr)>>, /* Kodierung mit 8, 16, 24 oder 32 Bits */
-        Combiner<NIL, LCTL_UNALIGNED>
+        Encoder<Token, Times<Plus<String<decltype("units"_tstr)>, Size<1>>, Size<8>>>, /* Kodierung mit 8, 16, 24 oder 32 Bits */
+        Combiner<Token, LCTL_UNALIGNED>
       >,
       Combiner<
         MultipleConcat<
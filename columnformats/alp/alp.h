@@ -0,0 +1,120 @@
+/*
+ * File:   alp.h
+ */
+
+#ifndef LCTL_FORMATS_ALP_ALP_H
+#define LCTL_FORMATS_ALP_ALP_H
+
+#include "../../Definitions.h"
+#include "../forbp/statfordynbp.h"
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+using namespace LCTL;
+
+namespace LCTL {
+  /**
+   * @brief ALP (adaptive lossless floating point compression): many floating point columns are decimals with a few digits
+   * (i.e. prices with two decimal places). For each block of 1024 values, an exponent e and a factor f are chosen,
+   * such that most values d are integers i = round(d * 10^e / 10^f) with d == i * 10^f / 10^e.
+   * The integers are reduced by the minimum of the block (frame of reference) and compressed with the integer format codeformat_t.
+   * Values, which can not be restored from their integer, are exceptions: their integer is replaced
+   * by the integer of the first regular value and their position and original value are stored behind the codes.
+   *
+   * Layout of each block: exponent (uint8_t), factor (uint8_t), 2 bytes padding, number of exceptions (uint32_t),
+   * minimum integer (int64_t), size of the compressed codes in bytes (uint64_t), compressed codes,
+   * positions of the exceptions (uint16_t, padded to 8 bytes), values of the exceptions.
+   * Compression and decompression are specializations of Compress and Decompress
+   * (see LCTL/conversion/columnformat/CompressALP.h and DecompressALP.h).
+   *
+   * @tparam codeformat_t  column format for the integers, base_t must be an unsigned integer with the size of float_t
+   * @tparam float_t       datatype of the input column, double or float
+   */
+  template <typename codeformat_t, typename float_t = double>
+  struct ALP {
+    using codeformat = codeformat_t;
+    using base_t = float_t;
+    using code_t = typename codeformat_t::base_t;
+    using signedcode_t = typename std::make_signed<code_t>::type;
+    using compressedbase_t = typename codeformat_t::compressedbase_t;
+    using processingStyle_t = typename codeformat_t::processingStyle_t;
+    static constexpr size_t staticTokensize = 0;
+    /* number of values with the same exponent and factor */
+    static constexpr size_t blocksize = 1024;
+    /* largest exponent, 10^maxExponent * d must be exact for decimals */
+    static constexpr size_t maxExponent = std::is_same<float_t, float>::value ? 10 : 18;
+    /* absolute value of an integer, which can be rounded exactly in double */
+    static constexpr double maxInteger = std::is_same<float_t, float>::value ? 2147483647.0 : 4503599627370496.0;
+    static constexpr size_t headerSize = 2 * sizeof(uint8_t) + 2 + sizeof(uint32_t) + sizeof(int64_t) + sizeof(uint64_t);
+
+    static_assert(sizeof(code_t) == sizeof(float_t), "ALP needs an integer code format with the size of the floating point datatype");
+
+    /**
+     * @brief 10^exponent
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static double power10(const size_t exponent) {
+      static constexpr double powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+      };
+      return powers[exponent];
+    }
+
+    /**
+     * @brief 10^-exponent
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static double inversePower10(const size_t exponent) {
+      static constexpr double powers[] = {
+        1e-0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9,
+        1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18
+      };
+      return powers[exponent];
+    }
+
+    /**
+     * @brief integer of value with exponent and factor, false if the value is too large
+     * (rounding to the nearest integer by adding and subtracting 2^52 + 2^51)
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static bool encode(const float_t value, const size_t exponent, const size_t factor, signedcode_t & integer) {
+      const double scaled = (double) value * power10(exponent) * inversePower10(factor);
+      if (!(std::fabs(scaled) < maxInteger))
+        return false;
+      const double magic = 6755399441055744.0;
+      integer = (signedcode_t) ((scaled + magic) - magic);
+      return true;
+    }
+
+    /**
+     * @brief value of an integer with exponent and factor
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static float_t decode(const signedcode_t integer, const size_t exponent, const size_t factor) {
+      return (float_t) ((double) integer * power10(factor) * inversePower10(exponent));
+    }
+  };
+}
+
+/**
+ * @brief ALP for double columns: integers of the decimals are bit packed per block (statfordynbp),
+ * the bitwidth depends on the range of the integers in a block.
+ *
+ * @param <processingStyle> TVL Processing Style of the integers, i.e. scalar<v64<uint64_t>>
+ * @param <scale_t>         scale of the blocksize of statfordynbp
+ * @param <float_t>         datatype of the input column, double or float (with scalar<v32<uint32_t>>)
+ */
+template <
+  typename processingStyle_t = vectorlib::scalar<vectorlib::v64<uint64_t>>,
+  size_t scale_t = 1,
+  typename float_t = double
+>
+using alp = ALP<
+  statfordynbp<
+    processingStyle_t,
+    0,
+    scale_t,
+    typename std::conditional<sizeof(float_t) == 8, uint64_t, uint32_t>::type
+  >,
+  float_t
+>;
+
+#endif /* LCTL_FORMATS_ALP_ALP_H */
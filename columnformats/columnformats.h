@@ -8,14 +8,27 @@
 #ifndef LCTL_FORMATS_FORMATS_H
 #define LCTL_FORMATS_FORMATS_H
 
+#include "VarintGB.h"
+#include "streamvbyte.h"
+
 #include "forbp/dynbp.h"
+#include "forbp/dynbptracks.h"
 #include "forbp/dynforbp.h"
+#include "forbp/pfor.h"
 #include "forbp/statbp.h"
 #include "forbp/statfordynbp.h"
 #include "forbp/statforstatbp.h"
 
 #include "delta/delta.h"
 
+#include "rle/rle.h"
+
+#include "xor/gorilla.h"
+
+#include "dictionary/dictionary.h"
+
+#include "simple/simple8b.h"
+
 /*#include "../compare/staticbp_8_8_1.h"
 #include "../compare/staticbp_8_8_2.h"
 #include "../compare/staticbp_8_8_3.h"
@@ -11,6 +11,10 @@
 #include "../../language/collate/Concepts.h"
 #include "../../language/collate/ColumnFormat.h"
 #include "../../language/calculation/arithmetics.h"
+#include "../../language/calculation/bitmanipulation.h"
+#include "../../language/calculation/aggregation.h"
+#include "../../language/calculation/literals.h"
+#include "../../language/calculation/Concat.h"
 #include "../../Definitions.h"
 
 using namespace LCTL;
@@ -54,5 +58,166 @@ ColumnFormat <
   inputDatatype_t
 >; 
 
+/**
+ * @brief delta for signed differences: the difference to the previous value is ZigZag mapped,
+ * such that small negative differences become small positive values
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v32<uint32_t>>
+ * @param <inputDatatype_t> datatype of the input column, i.e int64_t
+ */
+template <
+  typename processingStyle_t,
+  typename inputDatatype_t = NIL
+>
+using zigzagdelta = 
+ColumnFormat <
+  processingStyle_t,
+  Loop<
+    StaticTokenizer<1>,
+    ParameterCalculator<
+      ParameterDefinition<
+        String<decltype("ref"_tstr)>,
+        String<decltype("p"_tstr)>, 
+        Value<size_t,0>
+      >,
+      AdaptiveParameterDefinition<
+        ParameterDefinition<
+          String<decltype("p"_tstr)>,
+          Token,
+          Value<size_t,0>
+        >,
+        Value<inputDatatype_t,0>
+      >
+    >,
+    Encoder<
+      ZigZag<Minus<Token,String<decltype("ref"_tstr)>>>, 
+      Size< sizeof(
+        typename std::conditional<
+          (1==1) == std::is_same<inputDatatype_t, NIL>::value,
+          typename processingStyle_t::base_t,
+          inputDatatype_t
+        >::type
+      ) * 8 >
+    >,
+    Combiner<Token, LCTL_ALIGNED>
+  >,
+  inputDatatype_t
+>; 
+
+/**
+ * @brief delta with bit packed differences (D1): like dynbp, blocks of size processingStyle_t::vector_helper_t::size_bit::value * scale_t
+ * (as many values as a vector register has bits, i.e. 64 values for scalar<v64<uint64_t>>, 128 values for sse<v128<uint32_t>>)
+ * are bit packed with the bitwidth of the largest difference of the block, 
+ * each value is encoded as the difference to its predecessor, the first value of a block as difference to the last value of the previous block.
+ * The differences of a block are calculated once into a buffer of one block, which is used for the bitwidth and for the packing, the column is not materialized as differences.
+ * The decompression unpacks a whole block and restores the values with an in-register SIMD prefix sum.
+ * Suitable for sorted columns, i.e. ids.
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v64<uint64_t>>
+ * @param <scale_t>         scale of the blocksize
+ * @param <inputDatatype_t> datatype of the input column, i.e uint32_t
+ */
+template <
+  typename processingStyle_t, 
+  size_t scale_t = 1, 
+  typename inputDatatype_t = NIL
+>
+using deltabp = ColumnFormat <
+  processingStyle_t,
+  Loop<
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value * scale_t>,
+    ParameterCalculator<
+      ParameterDefinition<
+        String<decltype("ref"_tstr)>,
+        String<decltype("p"_tstr)>, 
+        Value<size_t,0>
+      >,
+      AdaptiveParameterDefinition<
+        ParameterDefinition<
+          String<decltype("p"_tstr)>,
+          Last<Token>,
+          Value<size_t,0>
+        >,
+        Value<inputDatatype_t,0>
+      >,
+      ParameterDefinition<
+        String<decltype("bitwidth"_tstr)>,
+        Bitwidth<Max<Delta<Token, String<decltype("ref"_tstr)>, 1>>>, 
+        Size<sizeof(typename processingStyle_t::base_t)*8>
+      >
+    >,
+    Loop<
+      StaticTokenizer<1>,
+      ParameterCalculator<>,
+      Encoder<Delta<Token, String<decltype("ref"_tstr)>, 1>, String<decltype("bitwidth"_tstr)>>,
+      Combiner<Token, LCTL_UNALIGNED>
+    >,
+    Combiner<
+      Concat<
+        String<decltype("bitwidth"_tstr)>,
+        Token
+      >, 
+      LCTL_ALIGNED
+    >
+  >,
+  inputDatatype_t
+>;
+
+/**
+ * @brief delta with bit packed differences (D4): like deltabp, but each value is encoded as the difference 
+ * to the value four positions before, the first four values of a block as difference to the last value of the previous block.
+ * The differences are about four times larger than in deltabp, but the decompression has no dependency between neighboured values,
+ * it only needs lane-wise vector additions.
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v64<uint64_t>>
+ * @param <scale_t>         scale of the blocksize
+ * @param <inputDatatype_t> datatype of the input column, i.e uint32_t
+ */
+template <
+  typename processingStyle_t, 
+  size_t scale_t = 1, 
+  typename inputDatatype_t = NIL
+>
+using delta4bp = ColumnFormat <
+  processingStyle_t,
+  Loop<
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value * scale_t>,
+    ParameterCalculator<
+      ParameterDefinition<
+        String<decltype("ref"_tstr)>,
+        String<decltype("p"_tstr)>, 
+        Value<size_t,0>
+      >,
+      AdaptiveParameterDefinition<
+        ParameterDefinition<
+          String<decltype("p"_tstr)>,
+          Last<Token>,
+          Value<size_t,0>
+        >,
+        Value<inputDatatype_t,0>
+      >,
+      ParameterDefinition<
+        String<decltype("bitwidth"_tstr)>,
+        Bitwidth<Max<Delta<Token, String<decltype("ref"_tstr)>, 4>>>, 
+        Size<sizeof(typename processingStyle_t::base_t)*8>
+      >
+    >,
+    Loop<
+      StaticTokenizer<1>,
+      ParameterCalculator<>,
+      Encoder<Delta<Token, String<decltype("ref"_tstr)>, 4>, String<decltype("bitwidth"_tstr)>>,
+      Combiner<Token, LCTL_UNALIGNED>
+    >,
+    Combiner<
+      Concat<
+        String<decltype("bitwidth"_tstr)>,
+        Token
+      >, 
+      LCTL_ALIGNED
+    >
+  >,
+  inputDatatype_t
+>;
+
 #endif /* LCTL_FORMATS_DELTA_DELTA_H */
 
@@ -0,0 +1,70 @@
+/* 
+ * File:   dictionary.h
+ */
+
+#ifndef LCTL_FORMATS_DICTIONARY_DICTIONARY_H
+#define LCTL_FORMATS_DICTIONARY_DICTIONARY_H
+
+#include "../../Definitions.h"
+#include "../forbp/dynbp.h"
+#include "../forbp/statbp.h"
+
+using namespace LCTL;
+
+namespace LCTL {
+  /**
+   * @brief Dictionary encoding: the sorted distinct values of the column are stored once in a header (dictionary),
+   * each value is replaced by its code (position in the dictionary), and the codes are compressed with codeformat_t.
+   * Because the dictionary is sorted, the codes preserve the order of the values.
+   * 
+   * Layout: number of distinct values (uint64_t), the dictionary (padded to 8 bytes), the compressed codes.
+   * The codes have the same datatype as the input column, thus codeformat_t must have the same base_t as the column.
+   * Compression and decompression are specializations of Compress and Decompress 
+   * (see LCTL/conversion/columnformat/CompressDictionary.h and DecompressDictionary.h).
+   *
+   * @tparam codeformat_t    column format for the codes, i.e. dynbp<scalar<v64<uint64_t>>, 1, uint64_t>
+   * @tparam codeBitwidth_t  maximal bitwidth of the codes, the column must have at most 2^codeBitwidth_t distinct values
+   */
+  template <typename codeformat_t, size_t codeBitwidth_t = sizeof(typename codeformat_t::base_t) * 8>
+  struct Dictionary {
+    using codeformat = codeformat_t;
+    static constexpr size_t codeBitwidth = codeBitwidth_t;
+    using base_t = typename codeformat_t::base_t;
+    using compressedbase_t = typename codeformat_t::compressedbase_t;
+    using processingStyle_t = typename codeformat_t::processingStyle_t;
+    static constexpr size_t staticTokensize = 0;
+  };
+}
+
+/**
+ * @brief dictionary encoding with bit packed codes, the bitwidth of the codes is determined for each block (dynbp).
+ * Low cardinality columns need only a few bits per value, independent of the width of the values.
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v64<uint64_t>>, 
+ * it contains also datatype that is used to handle the memory region with compressed codes
+ * @param <scale_t>         scale of the blocksize of dynbp
+ * @param <inputDatatype_t> datatype of the input column, i.e uint64_t
+ */
+template <
+  typename processingStyle_t, 
+  size_t scale_t = 1, 
+  typename inputDatatype_t = NIL
+>
+using dictionary = Dictionary<dynbp<processingStyle_t, scale_t, inputDatatype_t>>;
+
+/**
+ * @brief dictionary encoding with codes, which are bit packed with a fix bitwidth (statbp), 
+ * i.e. if the number of distinct values is known in advance
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v64<uint64_t>>
+ * @param <bitwidth_t>      bitwidth of the codes, the column must have at most 2^bitwidth_t distinct values
+ * @param <inputDatatype_t> datatype of the input column, i.e uint64_t
+ */
+template <
+  typename processingStyle_t, 
+  size_t bitwidth_t, 
+  typename inputDatatype_t = NIL
+>
+using statdictionary = Dictionary<statbp<processingStyle_t, bitwidth_t, inputDatatype_t>, bitwidth_t>;
+
+#endif /* LCTL_FORMATS_DICTIONARY_DICTIONARY_H */
@@ -20,21 +20,26 @@ using namespace LCTL;
  * @brief each value is encoded with the given bitwidth_t 
  * 
  * in scalar cases (processingStyle_t = scalar<vX<uintX_t>>), there is nothing special to attend.
- * @todo At the moment, we have only scalar processing and we must specify the Collate model as a recursion with blocks of X values, 
+ * We must specify the Collate model as a recursion with blocks of X values, 
  * such that X * bitwidth_t hits a word border.
+ * In SIMD cases (i.e. sse<v128<uint8_t>>), the values of a block are distributed round robin over the lanes,
+ * thus blocksize has to be a multiple of the number of lanes and (blocksize / lanes) * bitwidth_t has to hit a word border.
  *
- * @param <bitwidth_t>      bitwidth_t that is used to store each single data value, i.e. 8 bits
+ * @param <bitwidth_t>        bitwidth_t that is used to store each single data value, i.e. 8 bits
+ * @param <blocksize>         number of values per block
+ * @param <processingStyle_t> TVL Processing Style with 8 bit granularity
  * 
  * @date: 28.05.2021 12:00
  * @author: Juliana Hildebrandt
  */
 template <
   size_t bitwidth_t,
-  size_t blocksize 
+  size_t blocksize,
+  typename processingStyle_t = scalar<v8<uint8_t>>
 >
 using bpfranka = 
 ColumnFormat <
-  scalar<v8<uint8_t>>,
+  processingStyle_t,
   Loop<
     StaticTokenizer<blocksize>,
     ParameterCalculator<>,
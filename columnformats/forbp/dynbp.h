@@ -12,6 +12,7 @@
 #include "../../language/collate/ColumnFormat.h"
 #include "../../language/calculation/aggregation.h"
 #include "../../language/calculation/literals.h"
+#include "../../language/calculation/bitmanipulation.h"
 #include "../../Definitions.h"
 #include "../../language/calculation/Concat.h"
 
@@ -23,8 +24,10 @@ using namespace LCTL;
  * The bitwidth itself is encoded with sizeof(typename processingStyle::base_t) * 8 bits in front of the block values
  * 
  * in scalar cases (processingStyle_t = scalar<vX<uintX_t>>), there is nothing special to attend.
- * @todo At the moment, we have only scalar processing and we must specify the Collate model as a recursion with blocks of X values, 
- * such that X * bitwidth_t hits a word border.
+ * In SIMD cases (i.e. processingStyle_t = avx2<v256<uint32_t>>), the values are stored in a vertical layout
+ * and the input datatype has to be the same as the base_t of the processing style.
+ * @todo We must specify the Collate model as a recursion with blocks of X values, 
+ * such that X * bitwidth_t hits a word border (in each lane).
  *
  * @param <processingStyle> TVL Processing Style, i.e. scalar<v32<int32_t>>, 
  * it contains also datatype that is used to handle the memory region with compressed values
@@ -43,7 +46,7 @@ using dynbp = ColumnFormat <
   processingStyle_t,
   Loop<
     //StaticTokenizer<64*scale_t>,
-    StaticTokenizer<sizeof(typename processingStyle_t::base_t)*8*scale_t>,
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value * scale_t>,
     ParameterCalculator<
       ParameterDefinition<
         String<decltype("bitwidth"_tstr)>,
@@ -68,6 +71,48 @@ using dynbp = ColumnFormat <
   inputDatatype_t
 >;
 
+/**
+ * @brief dynbp for signed columns: the values are ZigZag mapped (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...), 
+ * the bitwidth of each block is the bitwidth of the maximum mapped value.
+ * Thus, blocks of values with a small absolute value are encoded with a small bitwidth.
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v32<uint32_t>>
+ * @param <scale_t>         scale of the blocksize
+ * @param <inputDatatype_t> datatype of the input column, i.e int32_t
+ */
+template <
+  typename processingStyle_t, 
+  size_t scale_t = 1, 
+  typename inputDatatype_t = NIL
+>
+using zigzagdynbp = ColumnFormat <
+  processingStyle_t,
+  Loop<
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value * scale_t>,
+    ParameterCalculator<
+      ParameterDefinition<
+        String<decltype("bitwidth"_tstr)>,
+        Bitwidth<Max<ZigZag<Token>>>, 
+        Size<sizeof(typename processingStyle_t::base_t)*8>
+      >
+    >,
+    Loop<
+      StaticTokenizer<1>,
+      ParameterCalculator<>,
+      Encoder<ZigZag<Token>, String<decltype("bitwidth"_tstr)>>,
+      Combiner<Token, LCTL_UNALIGNED>
+    >,
+    Combiner<
+      Concat<
+        String<decltype("bitwidth"_tstr)>,
+        Token
+      >, 
+      LCTL_ALIGNED
+    >
+  >,
+  inputDatatype_t
+>;
+
 
 #endif /* LCTL_FORMATS_FORBP_DYNBP_H */
 
@@ -0,0 +1,64 @@
+/* 
+ * File:   dynbptracks.h
+ */
+
+#ifndef LCTL_FORMATS_FORBP_DYNBPTRACKS_H
+#define LCTL_FORMATS_FORBP_DYNBPTRACKS_H
+
+#include "../../language/collate/Concepts.h"
+#include "../../language/collate/ColumnFormat.h"
+#include "../../language/calculation/aggregation.h"
+#include "../../language/calculation/literals.h"
+#include "../../Definitions.h"
+#include "../../language/calculation/Concat.h"
+
+using namespace LCTL;
+
+/**
+ * @brief dynbp (see dynbp.h) with two output tracks: the bitwidths of all blocks are written to a descriptor track,
+ * the encoded values to a data track. Thus, the data track contains no parameters and each block starts at a word (resp. register) border,
+ * the descriptor track can be read independently of the data (i.e. to calculate the position of each block).
+ * Use CompressTracks and DecompressTracks instead of Compress and Decompress.
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v32<int32_t>>, 
+ * it contains also datatype that is used to handle the memory region with compressed values
+ * @param <scale_t>         blocksize is processingStyle_t::vector_helper_t::size_bit::value * scale_t
+ * @param <inputDatatype_t> datatype of the input column, i.e uint8_t
+ */
+template <
+  typename processingStyle_t, 
+  size_t scale_t = 1, 
+  typename inputDatatype_t = NIL
+>
+using dynbptracks = ColumnFormat <
+  processingStyle_t,
+  Loop<
+    //StaticTokenizer<64*scale_t>,
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value * scale_t>,
+    ParameterCalculator<
+      ParameterDefinition<
+        String<decltype("bitwidth"_tstr)>,
+        Bitwidth<Max<Token>>, 
+        Size<sizeof(typename processingStyle_t::base_t)*8>
+      >
+    >,
+    Loop<
+      StaticTokenizer<1>,
+      ParameterCalculator<>,
+      Encoder<Token, String<decltype("bitwidth"_tstr)>>,
+      Combiner<Token, LCTL_UNALIGNED>
+    >,
+    Combiner<
+      Tracks<
+        Concat<String<decltype("bitwidth"_tstr)>>,
+        Concat<Token>
+      >, 
+      LCTL_ALIGNED
+    >
+  >,
+  inputDatatype_t
+>;
+
+
+#endif /* LCTL_FORMATS_FORBP_DYNBPTRACKS_H */
+
@@ -14,6 +14,7 @@
 #include "../../language/calculation/Concat.h"
 #include "../../language/calculation/aggregation.h"
 #include "../../language/calculation/arithmetics.h"
+#include "../../language/calculation/bitmanipulation.h"
 #include "../../language/calculation/literals.h"
 #include <type_traits>
 
@@ -29,14 +30,20 @@ using dynforbp =
   ColumnFormat <
     processingStyle_t,
     Loop<
-      StaticTokenizer<sizeof(typename processingStyle_t::base_t) * 8 * scale_t>,
+      StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value * scale_t>,
       ParameterCalculator<
         ParameterDefinition<
           String<decltype("min"_tstr)>,
           Min<Token>, 
           Value<
             size_t,
-            16
+            sizeof(
+              typename std::conditional<
+                true == std::is_same<inputDatatype_t, NIL>::value,
+                typename processingStyle_t::base_t,
+                inputDatatype_t
+              >::type
+            ) * 8
           >
         >,
         ParameterDefinition<
@@ -0,0 +1,71 @@
+/* 
+ * File:   pfor.h
+ */
+
+#ifndef LCTL_FORMATS_FORBP_PFOR_H
+#define LCTL_FORMATS_FORBP_PFOR_H
+
+#include "../../language/collate/Concepts.h"
+#include "../../language/collate/ColumnFormat.h"
+#include "../../language/calculation/aggregation.h"
+#include "../../language/calculation/literals.h"
+#include "../../Definitions.h"
+#include "../../language/calculation/Concat.h"
+
+using namespace LCTL;
+
+/**
+ * @brief Patched bit packing (PFOR/NewPFD): like dynbp, blocks of size processingStyle_t::vector_helper_t::size_bit::value * scale_t
+ * are bit packed with one bitwidth per block. The bitwidth is not determined by the maximum, 
+ * but it is the smallest bitwidth, such that at least percent_t percent of the values of the block fit into it.
+ * Thus, a few outliers do not inflate the bitwidth of the whole block.
+ * The outliers (exceptions) are encoded with their lowest bits in the block. 
+ * Behind the block, the patch area contains the number of exceptions and the position and the higher bits of each exception.
+ * After unpacking the whole block, the decompression patches the exceptions.
+ * 
+ * In SIMD cases (i.e. processingStyle_t = sse<v128<uint32_t>>), the block values are stored in a vertical layout like in dynbp,
+ * the positions in the patch area are positions in the (uncompressed) block.
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v32<uint32_t>>, 
+ * it contains also datatype that is used to handle the memory region with compressed values
+ * @param <scale_t>         scale of the blocksize
+ * @param <percent_t>       percentage of values of a block, which are encoded without exception
+ * @param <inputDatatype_t> datatype of the input column, i.e uint8_t
+ */
+template <
+  typename processingStyle_t, 
+  size_t scale_t = 1, 
+  size_t percent_t = 90,
+  typename inputDatatype_t = NIL
+>
+using pfor = ColumnFormat <
+  processingStyle_t,
+  Loop<
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value * scale_t>,
+    ParameterCalculator<
+      ParameterDefinition<
+        String<decltype("bitwidth"_tstr)>,
+        Bitwidth<Percentile<Token, percent_t>>, 
+        Size<sizeof(typename processingStyle_t::base_t)*8>
+      >
+    >,
+    Loop<
+      StaticTokenizer<1>,
+      ParameterCalculator<>,
+      Encoder<Token, String<decltype("bitwidth"_tstr)>>,
+      Combiner<Token, LCTL_UNALIGNED>
+    >,
+    Combiner<
+      Concat<
+        String<decltype("bitwidth"_tstr)>,
+        Token,
+        Exceptions
+      >, 
+      LCTL_ALIGNED
+    >
+  >,
+  inputDatatype_t
+>;
+
+
+#endif /* LCTL_FORMATS_FORBP_PFOR_H */
@@ -10,6 +10,7 @@
 
 
 #include "../../language/collate/ColumnFormat.h"
+#include "../../language/calculation/bitmanipulation.h"
 #include "../../Definitions.h"
 #include "../../language/collate/Concepts.h"
 #include "../../language/calculation/arithmetics.h"
@@ -20,8 +21,10 @@ using namespace LCTL;
  * @brief each value is encoded with the given bitwidth_t 
  * 
  * in scalar cases (processingStyle_t = scalar<vX<uintX_t>>), there is nothing special to attend.
- * @todo At the moment, we have only scalar processing and we must specify the Collate model as a recursion with blocks of X values, 
- * such that X * bitwidth_t hits a word border.
+ * In SIMD cases (i.e. processingStyle_t = avx2<v256<uint32_t>>), the values are stored in a vertical layout
+ * and the input datatype has to be the same as the base_t of the processing style.
+ * @todo We must specify the Collate model as a recursion with blocks of X values, 
+ * such that X * bitwidth_t hits a word border (in each lane).
  *
  * @param <processingStyle> TVL Processing Style, i.e. scalar<v32<int32_t>>, 
  * it contains also datatype that is used to handle the memory region with compressed values
@@ -40,7 +43,7 @@ using statbp =
 ColumnFormat <
   processingStyle_t,
   Loop<
-    StaticTokenizer< sizeof(typename processingStyle_t::base_t) * 8>,
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value>,
     ParameterCalculator<>,
     Loop<
       StaticTokenizer<1>,
@@ -54,5 +57,36 @@ ColumnFormat <
 >; 
 
 
+/**
+ * @brief statbp for signed columns: each value is ZigZag mapped (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+ * and encoded with the given bitwidth_t, thus values in [-2^(bitwidth_t-1), 2^(bitwidth_t-1)) can be encoded
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v32<uint32_t>>
+ * @param <bitwidth_t>      bitwidth_t that is used to store each single mapped data value
+ * @param <inputDatatype_t> datatype of the input column, i.e int32_t
+ */
+template <
+  typename processingStyle_t, 
+  size_t bitwidth_t, 
+  typename inputDatatype_t = NIL
+>
+using zigzagstatbp = 
+ColumnFormat <
+  processingStyle_t,
+  Loop<
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value>,
+    ParameterCalculator<>,
+    Loop<
+      StaticTokenizer<1>,
+      ParameterCalculator<>,
+      Encoder<ZigZag<Token>, Size<bitwidth_t>>,
+      Combiner<Token, LCTL_UNALIGNED>
+    >,
+    Combiner<Token, LCTL_ALIGNED>
+  >,
+  inputDatatype_t
+>; 
+
+
 #endif /* LCTL_FORMATS_FORBP_STATBP_H */
 
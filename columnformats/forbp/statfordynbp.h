@@ -26,9 +26,12 @@ using namespace LCTL;
  * Afterwards encode the decrement of all values of the block with the calculated bitwidth. 
  * No value has to start aligned, just append it at the current bitposition.
  * 
+ * In SIMD cases (i.e. sse<v128<uint32_t>>), a block contains processingStyle_t::vector_helper_t::size_bit values,
+ * the bitwidth is written to each lane and the values are distributed round robin over the lanes (vertical layout).
+ * 
  * @param <processingStyle_t> TVL Processing Style, contains also input granularity for scalar cases, i.e. scalar<v8<uint8_t>>
  * @param <scale_t>           to fill a block with compressed values without padding, 
- * we need a multiple of (sizeof(typename processingStyle_t::base_t) * 8) values. scale_t is necessary to set the number of values to a multiple
+ * we need a multiple of processingStyle_t::vector_helper_t::size_bit values. scale_t is necessary to set the number of values to a multiple
  */
 template <
   typename processingStyle_t,
@@ -39,7 +42,7 @@ template <
 using statfordynbp = ColumnFormat <
   processingStyle_t,
   Loop<
-    StaticTokenizer<sizeof(typename processingStyle_t::base_t) * 8 * scale_t>,
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value * scale_t>,
     ParameterCalculator<
       ParameterDefinition<
         String<decltype("bitwidth"_tstr)>,
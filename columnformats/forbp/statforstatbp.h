@@ -26,7 +26,7 @@ using statforstatbp =
   ColumnFormat <
     processingStyle_t,
     Loop<
-        StaticTokenizer<sizeof(typename processingStyle_t::base_t)*8>,
+        StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value>,
         ParameterCalculator<>,
         Loop<
             StaticTokenizer<1>,
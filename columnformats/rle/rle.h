@@ -0,0 +1,59 @@
+/* 
+ * File:   rle.h
+ */
+
+#ifndef LCTL_FORMATS_RLE_RLE_H
+#define LCTL_FORMATS_RLE_RLE_H
+
+#include "../../language/collate/Concepts.h"
+#include "../../language/collate/ColumnFormat.h"
+#include "../../language/calculation/literals.h"
+#include "../../Definitions.h"
+#include "../../language/calculation/Concat.h"
+
+using namespace LCTL;
+
+/**
+ * @brief Run-length encoding: the data dependent tokenizer outputs runs of equal values.
+ * Each run is encoded as its length (one word of the compressed datatype) followed by its value
+ * (with the width of the input datatype). Runs longer than the maximum of the compressed datatype are split.
+ * Sorted and low cardinality columns compress by orders of magnitude, the decompression is a memset resp. broadcast store per run.
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v32<uint32_t>>, 
+ * it contains also datatype that is used to handle the memory region with compressed values
+ * @param <inputDatatype_t> datatype of the input column, i.e uint8_t
+ */
+template <
+  typename processingStyle_t = vectorlib::scalar<vectorlib::v32<uint32_t>>, 
+  typename inputDatatype_t = NIL
+>
+using rle = ColumnFormat <
+  processingStyle_t,
+  Loop<
+    RunTokenizer<
+      String<decltype("runlength"_tstr)>,
+      Size<sizeof(typename processingStyle_t::base_t) * 8>
+    >,
+    ParameterCalculator<>,
+    Encoder<
+      Token, 
+      Size< sizeof(
+        typename std::conditional<
+          (1==1) == std::is_same<inputDatatype_t, NIL>::value,
+          typename processingStyle_t::base_t,
+          inputDatatype_t
+        >::type
+      ) * 8 >
+    >,
+    Combiner<
+      Concat<
+        String<decltype("runlength"_tstr)>,
+        Token
+      >, 
+      LCTL_ALIGNED
+    >
+  >,
+  inputDatatype_t
+>;
+
+#endif /* LCTL_FORMATS_RLE_RLE_H */
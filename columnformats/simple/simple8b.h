@@ -0,0 +1,76 @@
+/* 
+ * File:   simple8b.h
+ */
+
+#ifndef LCTL_FORMATS_SIMPLE_SIMPLE8B_H
+#define LCTL_FORMATS_SIMPLE_SIMPLE8B_H
+
+#include "../../language/collate/Concepts.h"
+#include "../../language/collate/ColumnFormat.h"
+#include "../../language/calculation/literals.h"
+#include "../../Definitions.h"
+#include "../../language/calculation/Concat.h"
+
+using namespace LCTL;
+
+/**
+ * @brief Simple-8b (Anh and Moffat): each 64 bit word contains a 4 bit selector and 60 bits of data.
+ * The selector determines the number of values in the word and their bitwidth (i.e. 30 values with 2 bits,
+ * 1 value with 60 bits). Selectors 0 and 1 encode runs of 240 resp. 120 zeros without any data bits.
+ * The selector is calculated greedily: the first case, such that the next values fit into the bitwidth of the case.
+ * Each case is generated as an unrolled kernel, the kernels are called via a jump table indexed by the selector.
+ * 
+ * In contrast to the original format, the selector is stored in the lowest 4 bits of the word,
+ * because the concat combiner writes its elements from the least significant bit.
+ * Values have to be smaller than 2^60, otherwise nothing is compressed and Compress returns 0.
+ *
+ * @param <processingStyle> TVL Processing Style, only scalar<v64<uint64_t>> is meaningful
+ * @param <inputDatatype_t> datatype of the input column, i.e uint32_t
+ */
+template <
+  typename processingStyle_t = vectorlib::scalar<vectorlib::v64<uint64_t>>, 
+  typename inputDatatype_t = NIL
+>
+using simple8b = ColumnFormat <
+  processingStyle_t,
+  Loop<
+    SwitchTokenizer<
+      String<decltype("selector"_tstr)>,
+      Size<4>,
+      String<decltype("bitwidth"_tstr)>,
+      TokenizerCase<240, 0>,
+      TokenizerCase<120, 0>,
+      TokenizerCase< 60, 1>,
+      TokenizerCase< 30, 2>,
+      TokenizerCase< 20, 3>,
+      TokenizerCase< 15, 4>,
+      TokenizerCase< 12, 5>,
+      TokenizerCase< 10, 6>,
+      TokenizerCase<  8, 7>,
+      TokenizerCase<  7, 8>,
+      TokenizerCase<  6,10>,
+      TokenizerCase<  5,12>,
+      TokenizerCase<  4,15>,
+      TokenizerCase<  3,20>,
+      TokenizerCase<  2,30>,
+      TokenizerCase<  1,60>
+    >,
+    ParameterCalculator<>,
+    Loop<
+      StaticTokenizer<1>,
+      ParameterCalculator<>,
+      Encoder<Token, String<decltype("bitwidth"_tstr)>>,
+      Combiner<Token, LCTL_UNALIGNED>
+    >,
+    Combiner<
+      Concat<
+        String<decltype("selector"_tstr)>,
+        Token
+      >, 
+      LCTL_ALIGNED
+    >
+  >,
+  inputDatatype_t
+>;
+
+#endif /* LCTL_FORMATS_SIMPLE_SIMPLE8B_H */
@@ -0,0 +1,56 @@
+/* 
+ * File:   streamvbyte.h
+ */
+
+#ifndef LCTL_FORMATS_STREAMVBYTE_H
+#define LCTL_FORMATS_STREAMVBYTE_H
+
+#include "../language/collate/ColumnFormat.h"
+#include "../language/collate/Concepts.h"
+#include "../language/calculation/Concat.h"
+#include "../language/calculation/literals.h"
+#include "../Definitions.h"
+
+using namespace LCTL;
+
+/**
+ * @brief Stream VByte (Lemire et al.): the same groups of four values with 2 bit units as VarintGB (see VarintGB.h),
+ * but the descriptor bytes of all groups are written to a contiguous control track and the data bytes to a data track.
+ * Thus, the decoding of the data does not depend on the position of the next descriptor byte.
+ * Decompression uses the table of 256 shuffle masks indexed by the descriptor byte (PSHUFB, if SSSE3 is available).
+ * Use CompressTracks and DecompressTracks instead of Compress and Decompress.
+ */
+using streamvbyte =
+  ColumnFormat<
+    scalar<v8<uint8_t>>,
+    Loop<
+      StaticTokenizer<4>,
+      ParameterCalculator<>,
+      Loop<
+        StaticTokenizer<1>,
+        ParameterCalculator<
+          ParameterDefinition<
+            String<decltype("units"_tstr)>,
+            /* bw 0..8 -> 0, bw 9..16 -> 1, bw 17..24 -> 2, bw 25..32 -> 3 */
+            Minus<
+              Div<Plus<Bitwidth<Token>, Size<7>>, Size<8>>,
+              Size<1>
+            >,
+            Size<2>
+          >
+        >,
+        Encoder<Token, Times<Plus<String<decltype("units"_tstr)>, Size<1>>, Size<8>>>,
+        Combiner<Token, LCTL_UNALIGNED>
+      >,
+      Combiner<
+        Tracks<
+          MultipleConcat<String<decltype("units"_tstr)>>,
+          Concat<Token>
+        >, 
+        LCTL_ALIGNED
+      >
+    >,
+    uint32_t
+  >; 
+
+#endif /* LCTL_FORMATS_STREAMVBYTE_H */
@@ -0,0 +1,59 @@
+/* 
+ * File:   gorilla.h
+ */
+
+#ifndef LCTL_FORMATS_XOR_GORILLA_H
+#define LCTL_FORMATS_XOR_GORILLA_H
+
+#include "../../language/collate/Concepts.h"
+#include "../../language/collate/ColumnFormat.h"
+#include "../../language/calculation/bitmanipulation.h"
+#include "../../language/calculation/literals.h"
+#include "../../language/calculation/Concat.h"
+#include "../../Definitions.h"
+
+using namespace LCTL;
+
+/**
+ * @brief Gorilla XOR compression for floating point columns: each value is XORed with its predecessor 
+ * (adaptive parameter like in delta), the result is written into a bit stream without its leading and trailing zeros.
+ * Equal consecutive values need one bit, slowly changing values share the window of leading and trailing zeros
+ * of their predecessor and need only 2 control bits and the meaningful bits.
+ *
+ * @param <processingStyle> TVL Processing Style, i.e. scalar<v64<uint64_t>>
+ * @param <inputDatatype_t> datatype of the input column, i.e double or float
+ */
+template <
+  typename processingStyle_t = vectorlib::scalar<vectorlib::v64<uint64_t>>,
+  typename inputDatatype_t = double
+>
+using gorilla = 
+ColumnFormat <
+  processingStyle_t,
+  Loop<
+    StaticTokenizer<1>,
+    ParameterCalculator<
+      ParameterDefinition<
+        String<decltype("ref"_tstr)>,
+        String<decltype("p"_tstr)>, 
+        Value<size_t,0>
+      >,
+      AdaptiveParameterDefinition<
+        ParameterDefinition<
+          String<decltype("p"_tstr)>,
+          Token,
+          Value<size_t,0>
+        >,
+        Value<size_t,0>
+      >
+    >,
+    Encoder<
+      Xor<Token,String<decltype("ref"_tstr)>>, 
+      Size<sizeof(inputDatatype_t) * 8>
+    >,
+    Combiner<MeaningfulBits<Token>, LCTL_UNALIGNED>
+  >,
+  inputDatatype_t
+>; 
+
+#endif /* LCTL_FORMATS_XOR_GORILLA_H */
@@ -0,0 +1,479 @@
+/*
+ * File:   Aggregate.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_AGGREGATE_H
+#define CONVERSION_COLUMNFORMAT_AGGREGATE_H
+
+#include "./DecompressConsume.h"
+#include "../../language/calculation/aggregation.h"
+#include "../../language/calculation/arithmetics.h"
+#include "../../language/calculation/bitmanipulation.h"
+#include "../../language/calculation/Concat.h"
+#include "../../language/collate/ColumnFormat.h"
+#include "../../codegeneration/Reduction.h"
+#include <header/preprocessor.h>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace LCTL {
+
+  /**
+   * @brief aggregation operators for Aggregate: initial value, aggregation of a block of values,
+   * and aggregation of a run of equal values.
+   * The sum is calculated modulo 2^64, signed values are sign extended.
+   * An empty block (count 0, i.e. a missing data tail) leaves the result unchanged.
+   *
+   * @tparam op_t    Sum<Token>, Min<Token>, Max<Token> or Count<Token>
+   * @tparam base_t  datatype of the values
+   */
+  template <typename op_t, typename base_t>
+  struct AggregateOp {};
+
+  template <typename base_t>
+  struct AggregateOp<Sum<Token>, base_t> {
+    using result_t = uint64_t;
+    static constexpr result_t initial = 0;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t block(const base_t * values, const size_t count, const result_t result) {
+      uint64_t sum = 0;
+      for (size_t i = 0; i < count; i++)
+        sum += (uint64_t) values[i];
+      return result + sum;
+    }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t run(const base_t value, const size_t count, const result_t result) {
+      return result + (uint64_t) value * count;
+    }
+  };
+
+  template <typename base_t>
+  struct AggregateOp<Min<Token>, base_t> {
+    using result_t = base_t;
+    static constexpr result_t initial = std::numeric_limits<base_t>::max();
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t block(const base_t * values, const size_t count, const result_t result) {
+      if (count == 0)
+        return result;
+      const base_t minimum = Reduction<base_t>::minReduce(values, count);
+      return minimum < result ? minimum : result;
+    }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t run(const base_t value, const size_t count, const result_t result) {
+      return value < result ? value : result;
+    }
+  };
+
+  template <typename base_t>
+  struct AggregateOp<Max<Token>, base_t> {
+    using result_t = base_t;
+    static constexpr result_t initial = std::numeric_limits<base_t>::min();
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t block(const base_t * values, const size_t count, const result_t result) {
+      if (count == 0)
+        return result;
+      const base_t maximum = Reduction<base_t>::maxReduce(values, count);
+      return maximum > result ? maximum : result;
+    }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t run(const base_t value, const size_t count, const result_t result) {
+      return value > result ? value : result;
+    }
+  };
+
+  template <typename base_t>
+  struct AggregateOp<Count<Token>, base_t> {
+    using result_t = size_t;
+    static constexpr result_t initial = 0;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t block(const base_t * values, const size_t count, const result_t result) {
+      return result + count;
+    }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t run(const base_t value, const size_t count, const result_t result) {
+      return result + count;
+    }
+  };
+
+  /**
+   * @brief sum of the fields of bitwidth bits in packed words, if bitwidth divides the word size:
+   * for each bit position k of a field, the set bits at position k of all fields of a word are counted,
+   * thus there are bitwidth population counts per word instead of one unpacking per field.
+   */
+  template <typename word_t>
+  MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t packedSum(const word_t * words, const size_t countWords, const size_t bitwidth) {
+    constexpr size_t wordbits = sizeof(word_t) * 8;
+    const word_t fieldmask = bitwidth >= wordbits ? (word_t) ~(word_t) 0 : (word_t) (((word_t) 1 << bitwidth) - 1);
+    const word_t lowbits = (word_t) ((word_t) ~(word_t) 0 / fieldmask);
+    uint64_t sum = 0;
+    for (size_t w = 0; w < countWords; w++)
+      for (size_t k = 0; k < bitwidth; k++)
+        sum += (uint64_t) __builtin_popcountll((uint64_t) (words[w] & (word_t) (lowbits << k))) << k;
+    return sum;
+  }
+
+  /**
+   * @brief consumer of DecompressConsume: aggregation of the decompressed values of a batch
+   */
+  template <typename aggregateop_t, typename base_t>
+  struct AggregateConsumer {
+    typename aggregateop_t::result_t result;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE void operator()(const base_t * values, const size_t count, const size_t position) {
+      result = aggregateop_t::block(values, count, result);
+    }
+  };
+
+  /**
+   * @brief aggregation block by block: each block is decompressed with DecompressConsume into a buffer in the L1 cache
+   * and aggregated, the decompressed column is never written.
+   * Formats with an adaptive reference (delta, deltabp) are supported as in DecompressConsume.
+   *
+   * @tparam format_t  column format with a static outer tokenizer
+   * @tparam op_t      Sum<Token>, Min<Token>, Max<Token> or Count<Token>
+   */
+  template <typename format_t, typename op_t>
+  struct AggregateBlocks {
+    using base_t = typename format_t::base_t;
+    using aggregateop_t = AggregateOp<op_t, base_t>;
+    using result_t = typename aggregateop_t::result_t;
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog)
+    {
+      AggregateConsumer<aggregateop_t, base_t> consumer{aggregateop_t::initial};
+      DecompressConsume<format_t>::apply(compressedMemoryRegion8, countInLog, consumer);
+      return consumer.result;
+    }
+  };
+
+  template <typename format_t, typename op_t>
+  struct AggregateFormat : AggregateBlocks<format_t, op_t> {};
+
+  /**
+   * @brief aggregation of a compressed column without writing the decompressed column.
+   * The structure of the format is used, where it is possible:
+   * - Count<Token> is the number of logical values and reads no compressed data
+   * - rle: the runs are aggregated (value * run length for sums), the runs are never expanded
+   * - scalar dynbp: Max<Token> decompresses only the blocks with the maximal bitwidth in the block headers
+   * - scalar dynforbp: Min<Token> is the minimum of the block references, Sum<Token> is the sum of reference * blocksize
+   *   and of the packed differences, Max<Token> decompresses only blocks with reference + 2^bitwidth - 1 above the current maximum
+   * - scalar statforstatbp: Sum<Token> is reference * count and the sum of the packed differences
+   * Other formats with a static outer tokenizer and operators are decompressed block by block into a buffer in the L1 cache
+   * (see AggregateBlocks), other formats with a data dependent outer tokenizer (varintgb, streamvbyte, simple8b) are rejected
+   * at compile time by DecompressConsume.
+   * The specializations for the formats are specializations of AggregateFormat.
+   *
+   * @tparam format_t  column format
+   * @tparam op_t      Sum<Token>, Min<Token>, Max<Token> or Count<Token>
+   */
+  template <typename format, typename op_t>
+  struct Aggregate : AggregateFormat<format, op_t> {
+    using format_t = format;
+  };
+
+  template <typename format>
+  struct Aggregate<format, Count<Token>> {
+    using format_t = format;
+    using result_t = size_t;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog)
+    {
+      return countInLog;
+    }
+  };
+
+  /**
+   * @brief rle: each run is a run length (one word) followed by the value (valueWords words)
+   */
+  template <typename processingStyle_t, typename name_t, size_t numberOfBits_t, size_t valueBits_t, bool aligned_t, typename inputbase_t, typename op_t>
+  struct AggregateFormat<
+    ColumnFormat <
+      processingStyle_t,
+      Loop<
+        RunTokenizer<name_t, Value<size_t, numberOfBits_t>>,
+        ParameterCalculator<>,
+        Encoder<Token, Value<size_t, valueBits_t>>,
+        Combiner<Concat<name_t, Token>, aligned_t>
+      >,
+      inputbase_t
+    >,
+    op_t
+  > {
+    using format_t = ColumnFormat <
+      processingStyle_t,
+      Loop<
+        RunTokenizer<name_t, Value<size_t, numberOfBits_t>>,
+        ParameterCalculator<>,
+        Encoder<Token, Value<size_t, valueBits_t>>,
+        Combiner<Concat<name_t, Token>, aligned_t>
+      >,
+      inputbase_t
+    >;
+    using base_t = typename format_t::base_t;
+    using word_t = typename format_t::compressedbase_t;
+    using aggregateop_t = AggregateOp<op_t, base_t>;
+    using result_t = typename aggregateop_t::result_t;
+    static constexpr size_t valueWords = (sizeof(base_t) + sizeof(word_t) - 1) / sizeof(word_t);
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog)
+    {
+      result_t result = aggregateop_t::initial;
+      const word_t * inBase = (const word_t *) compressedMemoryRegion8;
+      size_t i = 0;
+      while (i < countInLog) {
+        const size_t runLength = (size_t) *inBase;
+        inBase++;
+        base_t value;
+        std::memcpy(&value, inBase, sizeof(base_t));
+        inBase += valueWords;
+        result = aggregateop_t::run(value, runLength, result);
+        i += runLength;
+      }
+      return result;
+    }
+  };
+
+  /**
+   * @brief scalar dynbp: each block is the bitwidth (one word) followed by blocksize_t values with bitwidth bits
+   */
+  template <typename processingStyle_t, size_t blocksize_t, typename name_t, size_t numberOfBits_t, typename inputbase_t>
+  struct AggregateFormat<
+    ColumnFormat <
+      processingStyle_t,
+      Loop<
+        StaticTokenizer<blocksize_t>,
+        ParameterCalculator<ParameterDefinition<name_t, Bitwidth<Max<Token>>, Value<size_t, numberOfBits_t>>>,
+        Loop<
+          StaticTokenizer<1>,
+          ParameterCalculator<>,
+          Encoder<Token, name_t>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >,
+        Combiner<Concat<name_t, Token>, LCTL_ALIGNED>
+      >,
+      inputbase_t
+    >,
+    Max<Token>
+  > {
+    using format_t = ColumnFormat <
+      processingStyle_t,
+      Loop<
+        StaticTokenizer<blocksize_t>,
+        ParameterCalculator<ParameterDefinition<name_t, Bitwidth<Max<Token>>, Value<size_t, numberOfBits_t>>>,
+        Loop<
+          StaticTokenizer<1>,
+          ParameterCalculator<>,
+          Encoder<Token, name_t>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >,
+        Combiner<Concat<name_t, Token>, LCTL_ALIGNED>
+      >,
+      inputbase_t
+    >;
+    using base_t = typename format_t::base_t;
+    using word_t = typename format_t::compressedbase_t;
+    using result_t = base_t;
+    static constexpr bool scalar = std::is_same<typename processingStyle_t::base_t, typename processingStyle_t::vector_t>::value;
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog)
+    {
+      if (!scalar)
+        return AggregateBlocks<format_t, Max<Token>>::apply(compressedMemoryRegion8, countInLog);
+      const word_t * words = (const word_t *) compressedMemoryRegion8;
+      const size_t countBlocks = countInLog / blocksize_t;
+      /* first pass: maximal bitwidth in the block headers */
+      size_t maximalBitwidth = 0;
+      const word_t * block = words;
+      for (size_t b = 0; b < countBlocks; b++) {
+        const size_t bitwidth = (size_t) *block;
+        maximalBitwidth = bitwidth > maximalBitwidth ? bitwidth : maximalBitwidth;
+        block += 1 + (blocksize_t * bitwidth + sizeof(word_t) * 8 - 1) / (sizeof(word_t) * 8);
+      }
+      /* second pass: only blocks with the maximal bitwidth can contain the maximum */
+      base_t result = std::numeric_limits<base_t>::min();
+      base_t buffer[blocksize_t];
+      block = words;
+      for (size_t b = 0; b < countBlocks; b++) {
+        const size_t bitwidth = (size_t) *block;
+        if (bitwidth == maximalBitwidth) {
+          const uint8_t * block8 = (const uint8_t *) block;
+          uint8_t * buffer8 = (uint8_t *) buffer;
+          DecompressBlock<format_t>::apply(block8, buffer8);
+          result = AggregateOp<Max<Token>, base_t>::block(buffer, blocksize_t, result);
+        }
+        block += 1 + (blocksize_t * bitwidth + sizeof(word_t) * 8 - 1) / (sizeof(word_t) * 8);
+      }
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        std::cout << "// maximum in blocks with bitwidth " << maximalBitwidth << "\n";
+#     endif
+      /* data tail in uncompressed form */
+      const size_t countTail = countInLog - countBlocks * blocksize_t;
+      std::memcpy(buffer, block, countTail * sizeof(base_t));
+      return AggregateOp<Max<Token>, base_t>::block(buffer, countTail, result);
+    }
+  };
+
+  /**
+   * @brief scalar dynforbp: each block is the bitwidth (one word), the minimum (numberOfBitsMin_t bits, the width of the
+   * input datatype, low word first) and blocksize_t differences to the minimum with bitwidth bits.
+   * If the minimum does not fill whole words, the values do not start at a word border and the blocks are decompressed.
+   */
+  template <typename processingStyle_t, size_t blocksize_t, typename bitwidthname_t, typename minname_t, size_t numberOfBitsMin_t, size_t numberOfBits_t, typename inputbase_t, typename op_t>
+  struct AggregateFormat<
+    ColumnFormat <
+      processingStyle_t,
+      Loop<
+        StaticTokenizer<blocksize_t>,
+        ParameterCalculator<
+          ParameterDefinition<minname_t, Min<Token>, Value<size_t, numberOfBitsMin_t>>,
+          ParameterDefinition<bitwidthname_t, Bitwidth<Minus<Max<Token>, minname_t>>, Value<size_t, numberOfBits_t>>
+        >,
+        Loop<
+          StaticTokenizer<1>,
+          ParameterCalculator<>,
+          Encoder<Minus<Token, minname_t>, bitwidthname_t>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >,
+        Combiner<Concat<bitwidthname_t, minname_t, Token>, LCTL_ALIGNED>
+      >,
+      inputbase_t
+    >,
+    op_t
+  > {
+    using format_t = ColumnFormat <
+      processingStyle_t,
+      Loop<
+        StaticTokenizer<blocksize_t>,
+        ParameterCalculator<
+          ParameterDefinition<minname_t, Min<Token>, Value<size_t, numberOfBitsMin_t>>,
+          ParameterDefinition<bitwidthname_t, Bitwidth<Minus<Max<Token>, minname_t>>, Value<size_t, numberOfBits_t>>
+        >,
+        Loop<
+          StaticTokenizer<1>,
+          ParameterCalculator<>,
+          Encoder<Minus<Token, minname_t>, bitwidthname_t>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >,
+        Combiner<Concat<bitwidthname_t, minname_t, Token>, LCTL_ALIGNED>
+      >,
+      inputbase_t
+    >;
+    using base_t = typename format_t::base_t;
+    using word_t = typename format_t::compressedbase_t;
+    using aggregateop_t = AggregateOp<op_t, base_t>;
+    using result_t = typename aggregateop_t::result_t;
+    static constexpr size_t wordbits = sizeof(word_t) * 8;
+    /* number of words of the minimum */
+    static constexpr size_t minWords = numberOfBitsMin_t / wordbits;
+    static constexpr bool scalar = std::is_same<typename processingStyle_t::base_t, typename processingStyle_t::vector_t>::value;
+    static constexpr bool isSum = std::is_same<op_t, Sum<Token>>::value;
+    static constexpr bool isMin = std::is_same<op_t, Min<Token>>::value;
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog)
+    {
+      if (!scalar || numberOfBitsMin_t % wordbits != 0)
+        return AggregateBlocks<format_t, op_t>::apply(compressedMemoryRegion8, countInLog);
+      const size_t countBlocks = countInLog / blocksize_t;
+      result_t result = aggregateop_t::initial;
+      base_t buffer[blocksize_t];
+      const word_t * block = (const word_t *) compressedMemoryRegion8;
+      for (size_t b = 0; b < countBlocks; b++) {
+        const size_t bitwidth = (size_t) block[0];
+        base_t reference = 0;
+        for (size_t w = 0; w < minWords; w++)
+          reference |= (base_t) ((uint64_t) block[1 + w] << (w * wordbits));
+        const size_t countWords = (blocksize_t * bitwidth + wordbits - 1) / wordbits;
+        if (isMin) {
+          /* the reference is the minimum of the block */
+          result = aggregateop_t::run(reference, blocksize_t, result);
+        } else if (isSum && wordbits % bitwidth == 0) {
+          /* reference * blocksize and the sum of the packed differences */
+          result = (result_t) (result + (uint64_t) reference * blocksize_t + packedSum(block + 1 + minWords, countWords, bitwidth));
+        } else if (isSum || upperLimit(reference, bitwidth) > (uint64_t) result) {
+          /* decompression of the block, the maximum is only searched in blocks, which can contain a greater value */
+          const uint8_t * block8 = (const uint8_t *) block;
+          uint8_t * buffer8 = (uint8_t *) buffer;
+          DecompressBlock<format_t>::apply(block8, buffer8);
+          result = aggregateop_t::block(buffer, blocksize_t, result);
+        }
+        block += 1 + minWords + countWords;
+      }
+      /* data tail in uncompressed form */
+      const size_t countTail = countInLog - countBlocks * blocksize_t;
+      std::memcpy(buffer, block, countTail * sizeof(base_t));
+      return aggregateop_t::block(buffer, countTail, result);
+    }
+
+    /**
+     * @brief greatest value, which can be encoded in a block
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t upperLimit(const base_t reference, const size_t bitwidth) {
+      return (uint64_t) reference + (bitwidth >= 64 ? UINT64_MAX - (uint64_t) reference : ((uint64_t) 1 << bitwidth) - 1);
+    }
+  };
+
+  /**
+   * @brief scalar statforstatbp: blocks of blocksize_t differences to the reference with bitwidth_t bits, without headers
+   */
+  template <typename processingStyle_t, size_t blocksize_t, typename referencebase_t, referencebase_t reference_t, size_t bitwidth_t, typename inputbase_t>
+  struct AggregateFormat<
+    ColumnFormat <
+      processingStyle_t,
+      Loop<
+        StaticTokenizer<blocksize_t>,
+        ParameterCalculator<>,
+        Loop<
+          StaticTokenizer<1>,
+          ParameterCalculator<>,
+          Encoder<Minus<Token, Value<referencebase_t, reference_t>>, Value<size_t, bitwidth_t>>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >,
+        Combiner<Token, LCTL_ALIGNED>
+      >,
+      inputbase_t
+    >,
+    Sum<Token>
+  > {
+    using format_t = ColumnFormat <
+      processingStyle_t,
+      Loop<
+        StaticTokenizer<blocksize_t>,
+        ParameterCalculator<>,
+        Loop<
+          StaticTokenizer<1>,
+          ParameterCalculator<>,
+          Encoder<Minus<Token, Value<referencebase_t, reference_t>>, Value<size_t, bitwidth_t>>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >,
+        Combiner<Token, LCTL_ALIGNED>
+      >,
+      inputbase_t
+    >;
+    using base_t = typename format_t::base_t;
+    using word_t = typename format_t::compressedbase_t;
+    using result_t = uint64_t;
+    static constexpr size_t wordbits = sizeof(word_t) * 8;
+    static constexpr bool packed =
+      std::is_same<typename processingStyle_t::base_t, typename processingStyle_t::vector_t>::value &&
+      bitwidth_t > 0 && bitwidth_t <= wordbits && wordbits % bitwidth_t == 0;
+
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static result_t apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog)
+    {
+      if (!packed)
+        return AggregateBlocks<format_t, Sum<Token>>::apply(compressedMemoryRegion8, countInLog);
+      const size_t countPacked = countInLog / blocksize_t * blocksize_t;
+      const size_t countWords = countPacked * bitwidth_t / wordbits;
+      const word_t * words = (const word_t *) compressedMemoryRegion8;
+      uint64_t result = (uint64_t) (base_t) reference_t * countPacked + packedSum(words, countWords, bitwidth_t);
+      /* data tail in uncompressed form */
+      base_t buffer[blocksize_t];
+      std::memcpy(buffer, words + countWords, (countInLog - countPacked) * sizeof(base_t));
+      return AggregateOp<Sum<Token>, base_t>::block(buffer, countInLog - countPacked, result);
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_AGGREGATE_H */
@@ -122,10 +122,11 @@ namespace LCTL {
       
       size_t i = lcm_tokensize_t;
       size_t sizeSecondSum = 0;
+      /* one buffer for the intermediate values of a block, reused for all blocks */
+      uint8_t * outputRegionFirstConversion8 = (uint8_t *) malloc(sizeof(typename firstConversion_t::format_t::base_t) * lcm_tokensize_t);
       
       while(i <= countInLog) {
         
-        uint8_t * outputRegionFirstConversion8 = (uint8_t *) malloc(sizeof(typename firstConversion_t::format_t::base_t) * lcm_tokensize_t);
         size_t sizeFirst = firstConversion_t::apply(
           sourceMemoryRegion8 + i - lcm_tokensize_t,
           lcm_tokensize_t,
@@ -137,8 +138,8 @@ namespace LCTL {
                 lcm_tokensize_t, 
                 targetMemoryRegion8 + sizeSecondSum);
         i += lcm_tokensize_t;
-        free(outputRegionFirstConversion8);
       }
+      free(outputRegionFirstConversion8);
       return sizeSecondSum;
     }
   
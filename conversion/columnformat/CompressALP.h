@@ -0,0 +1,145 @@
+/*
+ * File:   CompressALP.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_COMPRESSALP_H
+#define CONVERSION_COLUMNFORMAT_COMPRESSALP_H
+
+#include "./Compress.h"
+#include "../../columnformats/alp/alp.h"
+#include <header/preprocessor.h>
+#include <cstring>
+#include <vector>
+
+namespace LCTL {
+
+  /**
+   * @brief compression for ALP formats: for each block, exponent and factor are chosen with a sample of the block,
+   * the values are converted to integers, the integers are compressed with the code format
+   * and the exceptions are written behind the codes
+   *
+   * @tparam codeformat_t  column format for the integers
+   * @tparam float_t       datatype of the input column
+   */
+  template <typename codeformat_t, typename float_t>
+  struct Compress<ALP<codeformat_t, float_t>>{
+
+    using format_t = ALP<codeformat_t, float_t>;
+    using base_t = typename format_t::base_t;
+    using code_t = typename format_t::code_t;
+    using signedcode_t = typename format_t::signedcode_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+    /* every sampleStride-th value of a block is used to choose exponent and factor */
+    static constexpr size_t sampleStride = 32;
+
+    /**
+     * @brief chooses exponent and factor with the smallest estimated size (exceptions and bitwidth of the integer range)
+     * for a sample of the block
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void choose(const base_t * inBase, const size_t count, uint8_t & exponent, uint8_t & factor) {
+      size_t bestSize = SIZE_MAX;
+      for (size_t e = 0; e <= format_t::maxExponent; e++) {
+        for (size_t f = 0; f <= e; f++) {
+          size_t exceptions = 0;
+          signedcode_t minimum = 0, maximum = 0;
+          bool first = true;
+          for (size_t i = 0; i < count; i += sampleStride) {
+            signedcode_t integer;
+            if (!format_t::encode(inBase[i], e, f, integer) || format_t::decode(integer, e, f) != inBase[i]) {
+              exceptions++;
+              continue;
+            }
+            if (first || integer < minimum) minimum = integer;
+            if (first || integer > maximum) maximum = integer;
+            first = false;
+          }
+          const uint64_t range = (uint64_t) maximum - (uint64_t) minimum;
+          const size_t bits = blockBitwidth(range);
+          const size_t size = exceptions * (sizeof(uint16_t) + sizeof(base_t)) * 8 + (count / sampleStride + 1 - exceptions) * bits;
+          if (size < bestSize) {
+            bestSize = size;
+            exponent = (uint8_t) e;
+            factor = (uint8_t) f;
+          }
+        }
+      }
+    }
+
+    /**
+     * @param uncompressedMemoryRegion8 uncompressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                number of logical data values
+     * @param compressedMemoryRegion8   memory region, where the compressed output is stored. Castet to uint8_t (single Bytes)
+     * @return                          size of the compressed values (headers, codes and exceptions), number of bytes
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t apply(
+            const uint8_t * uncompressedMemoryRegion8,
+            size_t countInLog,
+            uint8_t * compressedMemoryRegion8)
+    {
+      const base_t * inBase = (const base_t *) uncompressedMemoryRegion8;
+      uint8_t * out8 = compressedMemoryRegion8;
+      std::vector<code_t> codes(format_t::blocksize);
+      std::vector<uint16_t> positions;
+      std::vector<base_t> exceptions;
+      for (size_t start = 0; start < countInLog; start += format_t::blocksize) {
+        const size_t count = countInLog - start < format_t::blocksize ? countInLog - start : format_t::blocksize;
+        const base_t * block = inBase + start;
+        uint8_t exponent = 0, factor = 0;
+        choose(block, count, exponent, factor);
+        /* integers and exceptions */
+        positions.clear();
+        exceptions.clear();
+        signedcode_t filler = 0;
+        bool hasFiller = false;
+        signedcode_t minimum = 0;
+        for (size_t i = 0; i < count; i++) {
+          signedcode_t integer;
+          if (!format_t::encode(block[i], exponent, factor, integer) || format_t::decode(integer, exponent, factor) != block[i]
+              || (block[i] == 0 && std::signbit(block[i]))) {
+            positions.push_back((uint16_t) i);
+            exceptions.push_back(block[i]);
+            continue;
+          }
+          if (!hasFiller) {
+            filler = integer;
+            minimum = integer;
+            hasFiller = true;
+          }
+          if (integer < minimum) minimum = integer;
+          codes[i] = (code_t) integer;
+        }
+        for (size_t e = 0; e < positions.size(); e++)
+          codes[positions[e]] = (code_t) filler;
+        for (size_t i = 0; i < count; i++)
+          codes[i] = (code_t) (codes[i] - (code_t) minimum);
+#       if LCTL_VERBOSECOMPRESSIONCODE
+          std::cout << "// block " << start / format_t::blocksize << ": exponent " << (size_t) exponent << ", factor " << (size_t) factor << ", " << positions.size() << " exceptions\n";
+#       endif
+        /* header */
+        uint8_t * header8 = out8;
+        const uint32_t exceptionCount = (uint32_t) positions.size();
+        const int64_t frame = (int64_t) minimum;
+        std::memset(header8, 0, format_t::headerSize);
+        header8[0] = exponent;
+        header8[1] = factor;
+        std::memcpy(header8 + 4, &exceptionCount, sizeof(uint32_t));
+        std::memcpy(header8 + 8, &frame, sizeof(int64_t));
+        out8 += format_t::headerSize;
+        /* codes */
+        const uint64_t codeSize = Compress<codeformat_t>::apply((const uint8_t *) codes.data(), count, out8);
+        std::memcpy(header8 + 16, &codeSize, sizeof(uint64_t));
+        out8 += codeSize;
+        /* exceptions */
+        const size_t positionSize = (exceptionCount * sizeof(uint16_t) + 7) / 8 * 8;
+        std::memset(out8, 0, positionSize);
+        std::memcpy(out8, positions.data(), exceptionCount * sizeof(uint16_t));
+        out8 += positionSize;
+        std::memcpy(out8, exceptions.data(), exceptionCount * sizeof(base_t));
+        out8 += (exceptionCount * sizeof(base_t) + 7) / 8 * 8;
+      }
+      return out8 - compressedMemoryRegion8;
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_COMPRESSALP_H */
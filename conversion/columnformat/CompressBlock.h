@@ -28,14 +28,12 @@ namespace LCTL {
      * @param compressedMemoryRegion8   memory region, where the compressed output is stored. Castet to uin8_t (single Bytes)
      * @return                          size of the compressed values, number of bytes 
      * 
-     * @todo                For formats with a single output track in the compression direction, it is 
+     * For formats with a single output track in the compression direction, it is 
      * easy to return the compressed size as the number of used bytes. 
-     * In future there will be SIMD-formats with more than one output track 
-     * (i.e. one for the data, another one for descriptors/control like 
-     * selectors for Simple formats or units for Varint formats).
-     * Here it might be useful to return the size of the descriptor track
-     * We might have more then two output tracks (although at the moment I don't know why we should)
-     * What will we return here and how tp grab the right track?
+     * Formats with a descriptor track and a data track (Combiner<Tracks<...>, ...>)
+     * are compressed with CompressTracks, which returns the sizes of both tracks.
+     * 
+     * @todo blockwise compression for formats with more than one output track
      *
      * @date: 25.05.2021 12:00
      * @author: Juliana Hildebrandt
@@ -0,0 +1,60 @@
+/*
+ * File:   CompressBlockwise.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_COMPRESSBLOCKWISE_H
+#define CONVERSION_COLUMNFORMAT_COMPRESSBLOCKWISE_H
+
+#include "./Compress.h"
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  /**
+   * @brief compresses the column block by block of the static outer tokenizer, the last block contains the data tail.
+   * Before a block is compressed, the visitor is called with the index of the block, the logical position and
+   * the number of its values and the byte offset of its compressed block, i.e. to write a sidecar index (Lookup.h)
+   * or a zone map (ZoneMap.h).
+   *
+   * The compressed memory region is the same as with Compress<format>, if the format carries no state from one block
+   * to the next one (i.e. no adaptive parameters like the reference of deltabp).
+   *
+   * @tparam format_t  column format with a static outer tokenizer
+   */
+  template <typename format>
+  struct CompressBlockwise{
+
+    using format_t = format;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+    static_assert(staticTokensize > 0, "CompressBlockwise needs a static outer tokenizer");
+
+    /**
+     * @param uncompressedMemoryRegion8 uncompressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                number of logical data values
+     * @param compressedMemoryRegion8   memory region, where the compressed output is stored. Castet to uint8_t (single Bytes)
+     * @param visitor                   called as visitor(block, position, count, offset) for each block
+     * @return                          size of the compressed values, number of bytes
+     */
+    template <typename visitor_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t apply(
+            const uint8_t * uncompressedMemoryRegion8,
+            size_t countInLog,
+            uint8_t * compressedMemoryRegion8,
+            visitor_t & visitor)
+    {
+      size_t compressedSize = 0;
+      for (size_t i = 0; i < countInLog; i += staticTokensize) {
+        const size_t count = countInLog - i < staticTokensize ? countInLog - i : staticTokensize;
+        visitor(i / staticTokensize, i, count, compressedSize);
+        compressedSize += Compress<format_t>::apply(
+          uncompressedMemoryRegion8 + i * sizeof(base_t),
+          count,
+          compressedMemoryRegion8 + compressedSize);
+      }
+      return compressedSize;
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_COMPRESSBLOCKWISE_H */
@@ -0,0 +1,82 @@
+/* 
+ * File:   CompressDictionary.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_COMPRESSDICTIONARY_H
+#define CONVERSION_COLUMNFORMAT_COMPRESSDICTIONARY_H
+
+#include "./Compress.h"
+#include "../../columnformats/dictionary/dictionary.h"
+#include <header/preprocessor.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace LCTL {
+
+  /**
+   * @brief compression for dictionary formats: the sorted distinct values are written to the header,
+   * each value is replaced by its code and the codes are compressed with the code format.
+   * If the column has more distinct values than codes of codeBitwidth_t bits, nothing is written and 0 is returned.
+   * 
+   * @tparam codeformat_t    column format for the codes
+   * @tparam codeBitwidth_t  maximal bitwidth of the codes
+   */
+  template <typename codeformat_t, size_t codeBitwidth_t>
+  struct Compress<Dictionary<codeformat_t, codeBitwidth_t>>{
+    
+    using format_t = Dictionary<codeformat_t, codeBitwidth_t>;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+
+    /**
+     * @param uncompressedMemoryRegion8 uncompressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                number of logical data values
+     * @param compressedMemoryRegion8   memory region, where the compressed output is stored. Castet to uint8_t (single Bytes)
+     * @return                          size of the compressed values (header and codes), number of bytes,
+     *                                  0 if the column is not compressible with codes of codeBitwidth_t bits
+     *                                  (more than 2^codeBitwidth_t distinct values), nothing is written then
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t apply(
+            const uint8_t * uncompressedMemoryRegion8,
+            size_t countInLog,
+            uint8_t * compressedMemoryRegion8) 
+    {
+      const base_t * inBase = (const base_t *) uncompressedMemoryRegion8;
+      /* sorted distinct values */
+      std::vector<base_t> dictionary(inBase, inBase + countInLog);
+      std::sort(dictionary.begin(), dictionary.end());
+      dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        std::cout << "// dictionary with " << dictionary.size() << " distinct values\n";
+#     endif
+      const uint64_t distinct = dictionary.size();
+      /* the codes 0 ... distinct - 1 have to fit into codeBitwidth_t bits, otherwise they would be truncated */
+      if (codeBitwidth_t < 64 && distinct > ((uint64_t) 1 << codeBitwidth_t)) {
+#       if LCTL_VERBOSERUNTIME
+          std::cout << LCTL_WARNING << "Dictionary with " << distinct << " distinct values, codes with " << codeBitwidth_t << " bits can address only " << ((uint64_t) 1 << codeBitwidth_t) << " values. Nothing is compressed.\n";
+#       endif
+        return 0;
+      }
+      /* header */
+      uint8_t * out8 = compressedMemoryRegion8;
+      std::memcpy(out8, &distinct, sizeof(uint64_t));
+      out8 += sizeof(uint64_t);
+      const size_t dictionarySize = (distinct * sizeof(base_t) + 7) / 8 * 8;
+      std::memset(out8, 0, dictionarySize);
+      std::memcpy(out8, dictionary.data(), distinct * sizeof(base_t));
+      out8 += dictionarySize;
+      /* codes: positions in the sorted dictionary */
+      std::vector<base_t> codes(countInLog);
+      for (size_t i = 0; i < countInLog; i++)
+        codes[i] = (base_t) (std::lower_bound(dictionary.begin(), dictionary.end(), inBase[i]) - dictionary.begin());
+      return (out8 - compressedMemoryRegion8) + Compress<codeformat_t>::apply(
+          (const uint8_t *) codes.data(),
+          countInLog,
+          out8);
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_COMPRESSDICTIONARY_H */
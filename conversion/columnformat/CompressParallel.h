@@ -0,0 +1,128 @@
+/*
+ * File:   CompressParallel.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_COMPRESSPARALLEL_H
+#define CONVERSION_COLUMNFORMAT_COMPRESSPARALLEL_H
+
+#include "./Compress.h"
+#include "./FormatProperties.h"
+#include <header/preprocessor.h>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace LCTL {
+
+  /**
+   * @brief multi-threaded compression of one column. The column is partitioned at block borders of the static outer tokenizer,
+   * the partitions are compressed concurrently into slices of a caller-provided scratch region. The byte offsets of the compressed
+   * partitions are calculated with a prefix sum over their sizes, afterwards the slices are copied concurrently to the offsets.
+   * The first partition is compressed directly into the output.
+   *
+   * The scratch region is divided into slices of the same size, one for each partition except the first one, the slices start
+   * at word borders. Compress writes without a bound, thus before any thread starts, the worst-case size of each partition
+   * (CompressedBlockBound per block and the uncompressed data tail) is checked against its slice. If a slice is too small,
+   * the column is compressed sequentially. For the bit packing formats, a scratch region of twice the uncompressed size suffices
+   * for partitions of a few blocks.
+   *
+   * The compressed memory region is the same as with Compress<format>, thus Decompress<format> can be used.
+   * This holds for formats, whose blocks start at a word border (aligned outer combiner) and
+   * which carry no state from one block to the next one (i.e. no adaptive parameters like the reference of deltabp).
+   *
+   * @tparam format_t  column format with a static outer tokenizer
+   */
+  template <typename format>
+  struct CompressParallel{
+
+    using format_t = format;
+    using base_t = typename format_t::base_t;
+    using compressedbase_t = typename format_t::compressedbase_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+    static_assert(staticTokensize > 0, "CompressParallel needs a static outer tokenizer");
+    static_assert(HasAlignedOuterCombiner<format_t>::value, "CompressParallel needs an aligned outer combiner");
+    static_assert(!HasAdaptiveReference<format_t>::value, "CompressParallel needs a format without an adaptive reference");
+
+    /**
+     * @param uncompressedMemoryRegion8 uncompressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                number of logical data values
+     * @param compressedMemoryRegion8   memory region, where the compressed output is stored. Castet to uint8_t (single Bytes)
+     * @param scratchMemoryRegion8      caller-provided memory region for the compressed partitions except the first one
+     * @param scratchsize               number of bytes of the scratch region
+     * @param countThreads              number of threads, 0 means the number of hardware threads
+     * @return                          size of the compressed values, number of bytes
+     */
+    static size_t apply(
+            const uint8_t * uncompressedMemoryRegion8,
+            size_t countInLog,
+            uint8_t * compressedMemoryRegion8,
+            uint8_t * scratchMemoryRegion8,
+            size_t scratchsize,
+            size_t countThreads = 0)
+    {
+      if (countThreads == 0)
+        countThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+      const size_t countBlocks = (countInLog + staticTokensize - 1) / staticTokensize;
+      /* number of blocks per partition, the last partition contains the data tail */
+      const size_t blocksPerPartition = countBlocks > countThreads ? (countBlocks + countThreads - 1) / countThreads : 1;
+      const size_t partitionsize = blocksPerPartition * staticTokensize;
+      const size_t countPartitions = countInLog > 0 ? (countInLog + partitionsize - 1) / partitionsize : 0;
+      /* bytes of the slice of each partition except the first one, a multiple of the word size */
+      const size_t slicesize = countPartitions > 1 ? scratchsize / (countPartitions - 1) / sizeof(compressedbase_t) * sizeof(compressedbase_t) : 0;
+      /* worst-case size of a partition, the last partition contains the data tail */
+      const size_t lastCount = countInLog - (countPartitions > 0 ? countPartitions - 1 : 0) * partitionsize;
+      const size_t partitionBound = blocksPerPartition * CompressedBlockBound<format_t>::value;
+      const size_t lastBound = lastCount / staticTokensize * CompressedBlockBound<format_t>::value
+        + (lastCount % staticTokensize * sizeof(base_t) + sizeof(compressedbase_t) - 1) / sizeof(compressedbase_t) * sizeof(compressedbase_t);
+      const size_t bound = countPartitions > 2 && partitionBound > lastBound ? partitionBound : lastBound;
+      if (countPartitions <= 1 || slicesize < bound) {
+#       if LCTL_VERBOSERUNTIME
+          if (countPartitions > 1)
+            std::cout << LCTL_WARNING << "Slices of " << slicesize << " bytes of the scratch region too small for the worst-case size of " << bound << " bytes of a partition, sequential compression.\n";
+#       endif
+        return Compress<format_t>::apply(uncompressedMemoryRegion8, countInLog, compressedMemoryRegion8);
+      }
+
+      std::vector<uint8_t *> buffers(countPartitions, nullptr);
+      /* sizes of the compressed partitions, after the prefix sum their offsets */
+      std::vector<size_t> offsets(countPartitions + 1, 0);
+      std::vector<std::thread> threads;
+      threads.reserve(countPartitions);
+      for (size_t p = 0; p < countPartitions; p++) {
+        const size_t first = p * partitionsize;
+        const size_t count = countInLog - first < partitionsize ? countInLog - first : partitionsize;
+        buffers[p] = p == 0
+          ? compressedMemoryRegion8
+          : scratchMemoryRegion8 + (p - 1) * slicesize;
+        threads.emplace_back([&, p, first, count]() {
+          offsets[p + 1] = Compress<format_t>::apply(
+            uncompressedMemoryRegion8 + first * sizeof(base_t),
+            count,
+            buffers[p]);
+        });
+      }
+      for (auto & thread : threads)
+        thread.join();
+      threads.clear();
+
+      /* prefix sum: byte offset of each compressed partition */
+      for (size_t p = 1; p <= countPartitions; p++)
+        offsets[p] += offsets[p - 1];
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        std::cout << "// " << countPartitions << " partitions of " << partitionsize << " values, compressed size " << offsets[countPartitions] << "\n";
+#     endif
+
+      /* stitching, the first partition is already at its place */
+      for (size_t p = 1; p < countPartitions; p++)
+        threads.emplace_back([&, p]() {
+          memcpy(compressedMemoryRegion8 + offsets[p], buffers[p], offsets[p + 1] - offsets[p]);
+        });
+      for (auto & thread : threads)
+        thread.join();
+      return offsets[countPartitions];
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_COMPRESSPARALLEL_H */
@@ -0,0 +1,70 @@
+/* 
+ * File:   CompressTracks.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_COMPRESSTRACKS_H
+#define CONVERSION_COLUMNFORMAT_COMPRESSTRACKS_H
+
+#include "../../transformations/codegeneration/Generator.h"
+#include <header/preprocessor.h>
+#include <header/vector_extension_structs.h>
+#include <array>
+
+namespace LCTL {
+
+  /**
+   * @brief compression for formats with a combiner with two output tracks,
+   * i.e. Combiner<Tracks<Concat<String<decltype("bitwidth"_tstr)>>, Concat<Token>>, LCTL_ALIGNED>.
+   * Descriptors and data are written to separate memory regions.
+   * 
+   * @tparam format  column format with a Tracks-combiner
+   */
+  template <typename format>
+  struct CompressTracks{
+    
+    static constexpr size_t staticTokensize = format::staticTokensize;
+    using format_t = format;
+
+    /**
+     * @brief generates the compression code for the intermediate tree
+     * 
+     * @param uncompressedMemoryRegion8 uncompressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                number of logical data values
+     * @param descriptorMemoryRegion8   memory region, where the compressed descriptor track is stored. Castet to uint8_t (single Bytes)
+     * @param compressedMemoryRegion8   memory region, where the compressed data track is stored. Castet to uint8_t (single Bytes)
+     * @return                          sizes of the compressed tracks, number of bytes: {descriptor track, data track}
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static std::array<size_t, 2> apply(
+            const uint8_t * uncompressedMemoryRegion8,
+            size_t countInLog,
+            uint8_t * descriptorMemoryRegion8,
+            uint8_t * compressedMemoryRegion8) 
+    {
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        std::cout << "COMPRESSION CODE:\n";
+#     endif
+#     define LCTL_VERBOSECODE LCTL_VERBOSECOMPRESSIONCODE
+      uint8_t * descriptorMemoryRegion8Start = descriptorMemoryRegion8;
+      uint8_t * compressedMemoryRegion8Start = compressedMemoryRegion8;
+      Generator <
+        typename format_t::processingStyle_t,
+        typename format_t::transform,
+        typename format_t::base_t,
+        0,
+        0 >
+        ::compress(
+          uncompressedMemoryRegion8,
+          countInLog,
+          compressedMemoryRegion8,
+          descriptorMemoryRegion8
+        );
+      return {{
+        (size_t) (descriptorMemoryRegion8 - descriptorMemoryRegion8Start),
+        (size_t) (compressedMemoryRegion8 - compressedMemoryRegion8Start)
+      }};
+#     undef LCTL_VERBOSECODE
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_COMPRESSTRACKS_H */
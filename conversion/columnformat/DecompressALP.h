@@ -0,0 +1,81 @@
+/*
+ * File:   DecompressALP.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_DECOMPRESSALP_H
+#define CONVERSION_COLUMNFORMAT_DECOMPRESSALP_H
+
+#include "./Decompress.h"
+#include "../../columnformats/alp/alp.h"
+#include <header/preprocessor.h>
+#include <cstring>
+
+namespace LCTL {
+
+  /**
+   * @brief decompression for ALP formats: for each block, the integers are decompressed directly into the output,
+   * converted in place to floating point values and the exceptions are patched afterwards
+   *
+   * @tparam codeformat_t  column format for the integers
+   * @tparam float_t       datatype of the output column
+   */
+  template <typename codeformat_t, typename float_t>
+  struct Decompress<ALP<codeformat_t, float_t>>{
+
+    using format_t = ALP<codeformat_t, float_t>;
+    using base_t = typename format_t::base_t;
+    using code_t = typename format_t::code_t;
+    using signedcode_t = typename format_t::signedcode_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+
+    /**
+     * @param compressedMemoryRegion8       compressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                    number of logical data values
+     * @param decompressedMemoryRegion8     memory region, where the decompressed output is stored. Castet to uin8_t (single Bytes)
+     * @return                              size of the decompressed values, number of bytes
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t apply(
+      const uint8_t * compressedMemoryRegion8,
+      size_t countInLog,
+      uint8_t * decompressedMemoryRegion8)
+    {
+      const uint8_t * in8 = compressedMemoryRegion8;
+      base_t * outBase = (base_t *) decompressedMemoryRegion8;
+      for (size_t start = 0; start < countInLog; start += format_t::blocksize) {
+        const size_t count = countInLog - start < format_t::blocksize ? countInLog - start : format_t::blocksize;
+        /* header */
+        const size_t exponent = in8[0];
+        const size_t factor = in8[1];
+        uint32_t exceptionCount;
+        int64_t frame;
+        uint64_t codeSize;
+        std::memcpy(&exceptionCount, in8 + 4, sizeof(uint32_t));
+        std::memcpy(&frame, in8 + 8, sizeof(int64_t));
+        std::memcpy(&codeSize, in8 + 16, sizeof(uint64_t));
+        in8 += format_t::headerSize;
+#       if LCTL_VERBOSEDECOMPRESSIONCODE
+          std::cout << "// block " << start / format_t::blocksize << ": exponent " << exponent << ", factor " << factor << ", " << exceptionCount << " exceptions\n";
+#       endif
+        /* integers, converted in place */
+        base_t * block = outBase + start;
+        Decompress<codeformat_t>::apply(in8, count, (uint8_t *) block);
+        in8 += codeSize;
+        code_t * codes = (code_t *) block;
+        for (size_t i = 0; i < count; i++)
+          block[i] = format_t::decode((signedcode_t) (codes[i] + (code_t) frame), exponent, factor);
+        /* exceptions */
+        const uint8_t * positions8 = in8;
+        in8 += (exceptionCount * sizeof(uint16_t) + 7) / 8 * 8;
+        for (size_t e = 0; e < exceptionCount; e++) {
+          uint16_t position;
+          std::memcpy(&position, positions8 + e * sizeof(uint16_t), sizeof(uint16_t));
+          std::memcpy(block + position, in8 + e * sizeof(base_t), sizeof(base_t));
+        }
+        in8 += (exceptionCount * sizeof(base_t) + 7) / 8 * 8;
+      }
+      return countInLog * sizeof(base_t);
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_DECOMPRESSALP_H */
@@ -0,0 +1,85 @@
+/*
+ * File:   DecompressConsume.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_DECOMPRESSCONSUME_H
+#define CONVERSION_COLUMNFORMAT_DECOMPRESSCONSUME_H
+
+#include "./Decompress.h"
+#include "./DecompressBlock.h"
+#include "./DecompressCursor.h"
+#include "./FormatProperties.h"
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  /**
+   * @brief decompression fused with the consuming operator (filter, hash probe, projection, aggregation):
+   * the column is decompressed batch by batch into a buffer in the L1 cache, after each batch the consumer is called with
+   * the decompressed values. The decompressed column is never written, each value is written and read only in the L1 cache.
+   *
+   * The consumer is a compile time functor type with
+   *   void operator()(const base_t * values, size_t count, size_t position)
+   * where position is the logical position of values[0] in the column (a lambda or a struct, both are inlined).
+   *
+   * A batch consists of blocksPerBatch_t blocks of the static outer tokenizer, the data tail is the last, smaller batch.
+   * Each block is decompressed with the start value 0 of the adaptive parameters. As in DecompressCursor, for formats with
+   * an adaptive reference (delta, deltabp, delta4bp), the last value of the previous block is added afterwards to the values
+   * of the block. Adaptive references, which are not subtracted (i.e. the XOR of gorilla), are rejected at compile time.
+   * Formats with a data dependent outer tokenizer (rle, varintgb, streamvbyte, simple8b) have no batch size and are
+   * rejected at compile time, too.
+   *
+   * @tparam format_t          column format with a static outer tokenizer
+   * @tparam blocksPerBatch_t  number of blocks per batch
+   */
+  template <typename format, size_t blocksPerBatch_t = 1>
+  struct DecompressConsume{
+
+    using format_t = format;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+    static_assert(staticTokensize > 0, "DecompressConsume needs a static outer tokenizer");
+    static constexpr bool adaptive = HasAdaptiveReference<format_t>::value;
+    static_assert(!adaptive || HasAdditiveReference<format_t>::value, "DecompressConsume supports only adaptive references, which are subtracted (delta, deltabp)");
+    /* number of logical values per batch */
+    static constexpr size_t batchsize_t = staticTokensize * blocksPerBatch_t;
+
+    /**
+     * @param compressedMemoryRegion8 compressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog              number of logical data values
+     * @param consumer                functor, which is called once per batch
+     * @return                        number of consumed values
+     */
+    template <typename consumer_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog,
+            consumer_t & consumer)
+    {
+      base_t buffer[batchsize_t];
+      /* last decompressed value (reference of the next block for formats with an adaptive reference) */
+      base_t reference = 0;
+      size_t i = 0;
+      for (; i + batchsize_t <= countInLog; i += batchsize_t) {
+        uint8_t * buffer8 = (uint8_t *) buffer;
+        for (size_t block = 0; block < blocksPerBatch_t; block++) {
+          base_t * values = (base_t *) buffer8;
+          DecompressBlock<format_t>::apply(compressedMemoryRegion8, buffer8);
+          AddReference<base_t, adaptive>::apply(values, staticTokensize, reference);
+          reference = values[staticTokensize - 1];
+        }
+        consumer((const base_t *) buffer, batchsize_t, i);
+      }
+      /* remaining blocks and data tail, the data tail is stored with the original values */
+      if (i < countInLog) {
+        const size_t count = countInLog - i;
+        Decompress<format_t>::apply(compressedMemoryRegion8, count, (uint8_t *) buffer);
+        AddReference<base_t, adaptive>::apply(buffer, count / staticTokensize * staticTokensize, reference);
+        consumer((const base_t *) buffer, count, i);
+      }
+      return countInLog;
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_DECOMPRESSCONSUME_H */
@@ -0,0 +1,122 @@
+/*
+ * File:   DecompressCursor.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_DECOMPRESSCURSOR_H
+#define CONVERSION_COLUMNFORMAT_DECOMPRESSCURSOR_H
+
+#include "../../transformations/codegeneration/Generator.h"
+#include "../../language/collate/ColumnFormat.h"
+#include "./FormatProperties.h"
+#include <header/preprocessor.h>
+#include <type_traits>
+
+namespace LCTL {
+
+  /**
+   * @brief adds the reference of the previous batch to the values of a batch (wrap around like the differences during compression),
+   * nothing to do for formats without an adaptive reference
+   */
+  template <typename base_t, bool adaptive_t>
+  struct AddReference {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(base_t * buffer, const size_t count, const base_t reference) {}
+  };
+
+  template <typename base_t>
+  struct AddReference<base_t, true> {
+    using ubase_t = typename std::make_unsigned<base_t>::type;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(base_t * buffer, const size_t count, const base_t reference) {
+      for (size_t i = 0; i < count; i++)
+        buffer[i] = (base_t) ((ubase_t) buffer[i] + (ubase_t) reference);
+    }
+  };
+
+  /**
+   * @brief resumable decompression: the column is decompressed batch by batch into a caller-owned buffer,
+   * i.e. a buffer in the L1 cache of a vectorized query engine. The cursor keeps the position in the compressed
+   * and in the logical column between the calls of next.
+   *
+   * A batch consists of whole blocks of the static outer tokenizer (at least one block, at most batchsize_t values,
+   * if the blocksize allows it), thus only the last batch contains the data tail.
+   * The outer combiner has to be aligned, such that each batch starts at a word border of the compressed memory region.
+   *
+   * Each batch is decompressed like a column on its own, adaptive parameters start with their start value 0.
+   * For formats with an adaptive reference (the difference to the previous value as in delta and deltabp),
+   * the decoded values of a batch are the values minus the last value of the previous batch,
+   * this value is the state of the cursor and is added afterwards to the values of the whole blocks.
+   * Adaptive references, which are not subtracted (i.e. the XOR of gorilla), are rejected at compile time.
+   *
+   * @tparam format_t     column format with a static outer tokenizer
+   * @tparam batchsize_t  maximal number of logical values per batch
+   */
+  template <typename format, size_t batchsize_t = 1024>
+  struct DecompressCursor{
+
+    using format_t = format;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+    static_assert(staticTokensize > 0, "DecompressCursor needs a static outer tokenizer");
+    /* number of logical values per batch, the caller-owned buffer has to hold batchsize values */
+    static constexpr size_t batchsize = (batchsize_t / staticTokensize > 0 ? batchsize_t / staticTokensize : 1) * staticTokensize;
+    static_assert(HasAlignedOuterCombiner<format_t>::value, "DecompressCursor needs an aligned outer combiner");
+    static constexpr bool adaptive = HasAdaptiveReference<format_t>::value;
+    static_assert(!adaptive || HasAdditiveReference<format_t>::value, "DecompressCursor supports only adaptive references, which are subtracted (delta, deltabp)");
+
+    /* current position in the compressed memory region */
+    const uint8_t * compressedMemoryRegion8;
+    /* number of logical data values of the column */
+    const size_t countInLog;
+    /* logical position of the next value */
+    size_t position;
+    /* last decompressed value (reference of the next batch for formats with an adaptive reference) */
+    base_t reference;
+
+    /**
+     * @param compressedMemoryRegion8 compressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog              number of logical data values
+     */
+    DecompressCursor(const uint8_t * compressedMemoryRegion8, size_t countInLog)
+      : compressedMemoryRegion8(compressedMemoryRegion8), countInLog(countInLog), position(0), reference(0) {}
+
+    /**
+     * @return true, if all values are decompressed
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE bool done() const {
+      return position >= countInLog;
+    }
+
+    /**
+     * @brief decompresses the next batch
+     *
+     * @param buffer    output: caller-owned buffer with space for batchsize values
+     * @return          number of decompressed values, 0 if all values are decompressed
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE size_t next(base_t * buffer)
+    {
+      if (done())
+        return 0;
+      const size_t count = countInLog - position < batchsize ? countInLog - position : batchsize;
+      uint8_t * buffer8 = (uint8_t *) buffer;
+#     define LCTL_VERBOSECODE LCTL_VERBOSEDECOMPRESSIONCODE
+      compressedMemoryRegion8 = Generator <
+        typename format_t::processingStyle_t,
+        typename format_t::transform,
+        base_t,
+        0,
+        0 >
+        ::decompress(
+          compressedMemoryRegion8,
+          count,
+          buffer8
+        );
+#     undef LCTL_VERBOSECODE
+      /* the data tail (only in the last batch) is stored with the original values */
+      AddReference<base_t, adaptive>::apply(buffer, count / staticTokensize * staticTokensize, reference);
+      reference = buffer[count - 1];
+      position += count;
+      return count;
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_DECOMPRESSCURSOR_H */
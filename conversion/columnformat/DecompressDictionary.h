@@ -0,0 +1,60 @@
+/* 
+ * File:   DecompressDictionary.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_DECOMPRESSDICTIONARY_H
+#define CONVERSION_COLUMNFORMAT_DECOMPRESSDICTIONARY_H
+
+#include "./Decompress.h"
+#include "../../columnformats/dictionary/dictionary.h"
+#include <header/preprocessor.h>
+#include <cstring>
+
+namespace LCTL {
+
+  /**
+   * @brief decompression for dictionary formats: the header with the dictionary is read once,
+   * the codes are decompressed directly into the output and replaced by the dictionary values afterwards
+   * 
+   * @tparam codeformat_t  column format for the codes
+   */
+  template <typename codeformat_t, size_t codeBitwidth_t>
+  struct Decompress<Dictionary<codeformat_t, codeBitwidth_t>>{
+    
+    using format_t = Dictionary<codeformat_t, codeBitwidth_t>;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+
+    /**
+     * @param compressedMemoryRegion8       compressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                    number of logical data values
+     * @param decompressedMemoryRegion8     memory region, where the decompressed output is stored. Castet to uin8_t (single Bytes)
+     * @return                              size of the decompressed values, number of bytes 
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t apply(
+      const uint8_t * compressedMemoryRegion8,
+      size_t countInLog,
+      uint8_t * decompressedMemoryRegion8) 
+    {
+      /* header */
+      uint64_t distinct;
+      std::memcpy(&distinct, compressedMemoryRegion8, sizeof(uint64_t));
+      const base_t * dictionary = (const base_t *) (compressedMemoryRegion8 + sizeof(uint64_t));
+      const size_t dictionarySize = (distinct * sizeof(base_t) + 7) / 8 * 8;
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        std::cout << "// dictionary with " << distinct << " distinct values\n";
+#     endif
+      /* codes */
+      const size_t size = Decompress<codeformat_t>::apply(
+          compressedMemoryRegion8 + sizeof(uint64_t) + dictionarySize,
+          countInLog,
+          decompressedMemoryRegion8);
+      base_t * outBase = (base_t *) decompressedMemoryRegion8;
+      for (size_t i = 0; i < countInLog; i++)
+        outBase[i] = dictionary[outBase[i]];
+      return size;
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_DECOMPRESSDICTIONARY_H */
@@ -0,0 +1,178 @@
+/*
+ * File:   DecompressParallel.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_DECOMPRESSPARALLEL_H
+#define CONVERSION_COLUMNFORMAT_DECOMPRESSPARALLEL_H
+
+#include "./Compress.h"
+#include "./Decompress.h"
+#include "./DecompressCursor.h"
+#include <header/preprocessor.h>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace LCTL {
+
+  /**
+   * @brief entry of the partition directory: logical position of the first value of the partition,
+   * byte offset of the compressed partition and the adaptive reference before the partition (0 for formats without)
+   */
+  template <typename base_t>
+  struct Partition {
+    size_t position;
+    size_t offset;
+    base_t reference;
+  };
+
+  /**
+   * @brief subtracts the reference from the values (wrap around like the differences during compression),
+   * nothing to do for formats without an adaptive reference
+   */
+  template <typename base_t, bool adaptive_t>
+  struct SubtractReference {
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(const base_t * in, base_t * out, const size_t count, const base_t reference) {}
+  };
+
+  template <typename base_t>
+  struct SubtractReference<base_t, true> {
+    using ubase_t = typename std::make_unsigned<base_t>::type;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(const base_t * in, base_t * out, const size_t count, const base_t reference) {
+      for (size_t i = 0; i < count; i++)
+        out[i] = (base_t) ((ubase_t) in[i] - (ubase_t) reference);
+    }
+  };
+
+  /**
+   * @brief parallel decompression of one column. During compression, a directory with the logical position, the byte offset
+   * and the adaptive reference (i.e. the last value before the partition for deltabp) is written for each partition of
+   * partitionsize_t values. The decompression distributes the partitions to the threads, each partition is decompressed
+   * on its own into its place in the output.
+   *
+   * Each partition is decompressed with the start value 0 of the adaptive parameters. As in DecompressCursor, the reference of
+   * the partition is added afterwards to the values of the whole blocks. To get the same compressed memory region as with
+   * Compress<format>, formats with an adaptive reference are compressed batch by batch: the whole blocks of a batch are reduced
+   * by the last value before the batch, the data tail is stored with the original values as in the sequential compression.
+   * The outer combiner has to be aligned.
+   *
+   * @tparam format_t          column format with a static outer tokenizer
+   * @tparam partitionsize_t   maximal number of logical values per partition, rounded down to whole blocks
+   */
+  template <typename format, size_t partitionsize_t = 65536>
+  struct DecompressParallel{
+
+    using format_t = format;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+    static_assert(staticTokensize > 0, "DecompressParallel needs a static outer tokenizer");
+    /* number of logical values per partition */
+    static constexpr size_t partitionsize = (partitionsize_t / staticTokensize > 0 ? partitionsize_t / staticTokensize : 1) * staticTokensize;
+    static_assert(HasAlignedOuterCombiner<format_t>::value, "DecompressParallel needs an aligned outer combiner");
+    static constexpr bool adaptive = HasAdaptiveReference<format_t>::value;
+    static_assert(!adaptive || HasAdditiveReference<format_t>::value, "DecompressParallel supports only adaptive references, which are subtracted (delta, deltabp)");
+    /* number of logical values per batch for the compression of formats with an adaptive reference */
+    static constexpr size_t batchsize = DecompressCursor<format_t>::batchsize < partitionsize ? DecompressCursor<format_t>::batchsize : partitionsize;
+
+    /**
+     * @brief compresses the column partition by partition and writes the directory
+     *
+     * @param uncompressedMemoryRegion8 uncompressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                number of logical data values
+     * @param compressedMemoryRegion8   memory region, where the compressed output is stored. Castet to uint8_t (single Bytes)
+     * @param directory                 output: one entry per partition
+     * @return                          size of the compressed values, number of bytes
+     */
+    static size_t compress(
+            const uint8_t * uncompressedMemoryRegion8,
+            size_t countInLog,
+            uint8_t * compressedMemoryRegion8,
+            std::vector<Partition<base_t>> & directory)
+    {
+      const base_t * in = (const base_t *) uncompressedMemoryRegion8;
+      directory.clear();
+      directory.reserve((countInLog + partitionsize - 1) / partitionsize);
+      size_t compressedSize = 0;
+      base_t reference = 0;
+      for (size_t first = 0; first < countInLog; first += partitionsize) {
+        const size_t count = countInLog - first < partitionsize ? countInLog - first : partitionsize;
+        directory.push_back(Partition<base_t>{first, compressedSize, reference});
+        if (adaptive) {
+          /*
+           * the differences of the shifted values with the reference 0 are the differences of the sequential compression,
+           * the data tail (only in the last batch of the column) is stored with the original values
+           */
+          base_t buffer[batchsize];
+          for (size_t i = first; i < first + count; i += batchsize) {
+            const size_t countBatch = first + count - i < batchsize ? first + count - i : batchsize;
+            const size_t countBlocks = countBatch / staticTokensize * staticTokensize;
+            SubtractReference<base_t, adaptive>::apply(in + i, buffer, countBlocks, i > 0 ? in[i - 1] : 0);
+            memcpy(buffer + countBlocks, in + i + countBlocks, (countBatch - countBlocks) * sizeof(base_t));
+            compressedSize += Compress<format_t>::apply((const uint8_t *) buffer, countBatch, compressedMemoryRegion8 + compressedSize);
+          }
+          reference = in[first + count - 1];
+        } else {
+          compressedSize += Compress<format_t>::apply(
+            uncompressedMemoryRegion8 + first * sizeof(base_t),
+            count,
+            compressedMemoryRegion8 + compressedSize);
+        }
+      }
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        std::cout << "// directory with " << directory.size() << " partitions\n";
+#     endif
+      return compressedSize;
+    }
+
+    /**
+     * @brief decompresses the partitions concurrently, each thread decompresses a range of consecutive partitions
+     *
+     * @param compressedMemoryRegion8   compressed input data, castet to uint8_t (single Bytes)
+     * @param directory                 directory written by compress
+     * @param countInLog                number of logical data values
+     * @param decompressedMemoryRegion8 memory region, where the decompressed output is stored. Castet to uint8_t (single Bytes)
+     * @param countThreads              number of threads, 0 means the number of hardware threads
+     * @return                          size of the decompressed values, number of bytes
+     */
+    static size_t apply(
+            const uint8_t * compressedMemoryRegion8,
+            const std::vector<Partition<base_t>> & directory,
+            size_t countInLog,
+            uint8_t * decompressedMemoryRegion8,
+            size_t countThreads = 0)
+    {
+      if (countThreads == 0)
+        countThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+      const size_t countPartitions = directory.size();
+      const size_t partitionsPerThread = countPartitions > countThreads ? (countPartitions + countThreads - 1) / countThreads : 1;
+      std::vector<std::thread> threads;
+      for (size_t firstPartition = 0; firstPartition < countPartitions; firstPartition += partitionsPerThread)
+        threads.emplace_back([&, firstPartition]() {
+          for (size_t p = firstPartition; p < firstPartition + partitionsPerThread && p < countPartitions; p++)
+            decompressPartition(compressedMemoryRegion8, directory[p], countInLog, decompressedMemoryRegion8);
+        });
+      for (auto & thread : threads)
+        thread.join();
+      return countInLog * sizeof(base_t);
+    }
+
+  private:
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decompressPartition(
+            const uint8_t * compressedMemoryRegion8,
+            const Partition<base_t> & partition,
+            size_t countInLog,
+            uint8_t * decompressedMemoryRegion8)
+    {
+      const size_t count = countInLog - partition.position < partitionsize ? countInLog - partition.position : partitionsize;
+      base_t * out = (base_t *) decompressedMemoryRegion8 + partition.position;
+      Decompress<format_t>::apply(
+        compressedMemoryRegion8 + partition.offset,
+        count,
+        (uint8_t *) out);
+      AddReference<base_t, adaptive>::apply(out, count / staticTokensize * staticTokensize, partition.reference);
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_DECOMPRESSPARALLEL_H */
@@ -0,0 +1,68 @@
+/* 
+ * File:   DecompressTracks.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_DECOMPRESSTRACKS_H
+#define CONVERSION_COLUMNFORMAT_DECOMPRESSTRACKS_H
+
+#include "../../transformations/codegeneration/Generator.h"
+#include <header/preprocessor.h>
+#include <header/vector_extension_structs.h>
+#include <array>
+
+namespace LCTL {
+
+  /**
+   * @brief decompression for formats with a combiner with two output tracks (see CompressTracks)
+   * 
+   * @tparam format  column format with a Tracks-combiner
+   */
+  template <typename format>
+  struct DecompressTracks{
+    
+    static constexpr size_t staticTokensize = format::staticTokensize;
+    using format_t = format;
+
+   /**
+     * @brief generates the decompression code for the intermediate tree
+     * 
+     * @param descriptorMemoryRegion8       compressed descriptor track, castet to uint8_t (single Bytes)
+     * @param compressedMemoryRegion8       compressed data track, castet to uint8_t (single Bytes)
+     * @param countInLog                    number of logical data values
+     * @param decompressedMemoryRegion8     memory region, where the decompressed output is stored. Castet to uin8_t (single Bytes)
+     * @return                              number of read bytes of the compressed tracks: {descriptor track, data track}
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static std::array<size_t, 2> apply(
+      const uint8_t * descriptorMemoryRegion8,
+      const uint8_t * compressedMemoryRegion8,
+      size_t countInLog,
+      uint8_t * decompressedMemoryRegion8) 
+    {
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        std::cout << "DECOMPRESSION CODE:\n";
+#     endif
+#     define LCTL_VERBOSECODE LCTL_VERBOSEDECOMPRESSIONCODE
+      const uint8_t * descriptorMemoryRegion8Start = descriptorMemoryRegion8;
+      const uint8_t * compressedMemoryRegion8Start = compressedMemoryRegion8;
+      Generator < 
+        typename format_t::processingStyle_t,
+        typename format_t::transform, 
+        typename format_t::base_t, 
+        0, 
+        0 
+      > ::decompress(
+          compressedMemoryRegion8, 
+          countInLog, 
+          decompressedMemoryRegion8,
+          descriptorMemoryRegion8
+        );
+      return {{
+        (size_t) (descriptorMemoryRegion8 - descriptorMemoryRegion8Start),
+        (size_t) (compressedMemoryRegion8 - compressedMemoryRegion8Start)
+      }};
+#     undef LCTL_VERBOSECODE
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_DECOMPRESSTRACKS_H */
@@ -0,0 +1,153 @@
+/*
+ * File:   FormatProperties.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_FORMATPROPERTIES_H
+#define CONVERSION_COLUMNFORMAT_FORMATPROPERTIES_H
+
+#include "../../language/collate/Concepts.h"
+#include "../../language/collate/ColumnFormat.h"
+#include "../../language/calculation/arithmetics.h"
+#include "../../language/calculation/bitmanipulation.h"
+#include "../../language/calculation/Concat.h"
+#include "../../codegeneration/ProcessingStyle.h"
+#include "../../Definitions.h"
+#include <type_traits>
+
+namespace LCTL {
+
+  /**
+   * @brief true, if one of the parameter definitions is an adaptive parameter
+   */
+  template <typename... pads>
+  struct HasAdaptiveParameter : std::false_type {};
+
+  template <typename pad_t, typename... pads>
+  struct HasAdaptiveParameter<pad_t, pads...> : HasAdaptiveParameter<pads...> {};
+
+  template <typename parameterDefinition_t, typename startValue_t, int recursionLevel, typename... pads>
+  struct HasAdaptiveParameter<AdaptiveParameterDefinition<parameterDefinition_t, startValue_t, recursionLevel>, pads...> : std::true_type {};
+
+  /**
+   * @brief true, if the outer loop of the column format carries an adaptive reference from one block to the next one
+   * (delta, zigzagdelta, deltabp, delta4bp, gorilla). Formats with an adaptive reference can not be decompressed
+   * block by block without this state (DecompressConsume, CompressParallel).
+   */
+  template <typename format_t>
+  struct HasAdaptiveReference : std::false_type {};
+
+  template <typename processingStyle_t, typename tokenizer_t, typename... pads, typename recursion_t, typename combiner_t, typename inputbase_t>
+  struct HasAdaptiveReference<
+    ColumnFormat<processingStyle_t, Loop<tokenizer_t, ParameterCalculator<pads...>, recursion_t, combiner_t>, inputbase_t>
+  > : HasAdaptiveParameter<pads...> {};
+
+  /**
+   * @brief true, if the outer combiner of the column format is aligned, thus each block of the static outer tokenizer
+   * starts at a word border of the compressed memory region and a sequence of blocks can be decompressed on its own
+   */
+  template <typename format_t>
+  struct HasAlignedOuterCombiner : std::false_type {};
+
+  template <typename processingStyle_t, typename tokenizer_t, typename parameterCalculator_t, typename recursion_t, typename func_combine, typename inputbase_t>
+  struct HasAlignedOuterCombiner<
+    ColumnFormat<processingStyle_t, Loop<tokenizer_t, parameterCalculator_t, recursion_t, Combiner<func_combine, LCTL_ALIGNED>>, inputbase_t>
+  > : std::true_type {};
+
+  /**
+   * @brief true, if the encoder is the difference to the reference (Minus, Delta, ZigZag of Minus).
+   * Values decoded with the reference 0 are the original values minus the reference, thus the reference can be added afterwards.
+   * This does not hold for other adaptive references, i.e. the XOR of gorilla.
+   */
+  template <typename recursion_t>
+  struct IsAdditiveEncoding : std::false_type {};
+
+  template <typename ref_t, typename numberOfBits_t>
+  struct IsAdditiveEncoding<Encoder<Minus<Token, ref_t>, numberOfBits_t>> : std::true_type {};
+
+  template <typename ref_t, size_t distance_t, typename numberOfBits_t>
+  struct IsAdditiveEncoding<Encoder<Delta<Token, ref_t, distance_t>, numberOfBits_t>> : std::true_type {};
+
+  template <typename ref_t, typename numberOfBits_t>
+  struct IsAdditiveEncoding<Encoder<ZigZag<Minus<Token, ref_t>>, numberOfBits_t>> : std::true_type {};
+
+  template <typename tokenizer_t, typename parameterCalculator_t, typename recursion_t, typename combiner_t>
+  struct IsAdditiveEncoding<Loop<tokenizer_t, parameterCalculator_t, recursion_t, combiner_t>> : IsAdditiveEncoding<recursion_t> {};
+
+  /**
+   * @brief true, if the adaptive reference of the column format is additive (delta, zigzagdelta, deltabp, delta4bp)
+   */
+  template <typename format_t>
+  struct HasAdditiveReference : std::false_type {};
+
+  template <typename processingStyle_t, typename loop_t, typename inputbase_t>
+  struct HasAdditiveReference<ColumnFormat<processingStyle_t, loop_t, inputbase_t>> : IsAdditiveEncoding<loop_t> {};
+
+  /**
+   * @brief number of parameter definitions and sum of their bits (the physical calculation Value<T, bits>)
+   */
+  template <typename... pads>
+  struct ParameterBits {
+    static constexpr size_t count = 0;
+    static constexpr size_t bits = 0;
+  };
+
+  template <typename pad_t, typename... pads>
+  struct ParameterBits<pad_t, pads...> : ParameterBits<pads...> {};
+
+  template <typename name_t, typename logicalCalculation_t, typename T, T bits_t, typename... pads>
+  struct ParameterBits<ParameterDefinition<name_t, logicalCalculation_t, Value<T, bits_t>>, pads...> {
+    static constexpr size_t count = 1 + ParameterBits<pads...>::count;
+    static constexpr size_t bits = (size_t) bits_t + ParameterBits<pads...>::bits;
+  };
+
+  /**
+   * @brief worst-case number of bits of an encoded value of a block: the width of base_t,
+   * or the static bitwidth of the encoder, if it is greater
+   */
+  template <typename recursion_t, typename base_t>
+  struct MaxValueBits : std::integral_constant<size_t, sizeof(base_t) * 8> {};
+
+  template <typename logicalencoding_t, size_t bitwidth_t, typename combiner_t, typename base_t>
+  struct MaxValueBits<Loop<StaticTokenizer<1>, ParameterCalculator<>, Encoder<logicalencoding_t, Value<size_t, bitwidth_t>>, combiner_t>, base_t>
+    : std::integral_constant<size_t, (bitwidth_t > sizeof(base_t) * 8 ? bitwidth_t : sizeof(base_t) * 8)> {};
+
+  /**
+   * @brief true, if the combine function concats an exception list (patch area) behind the block (PFOR)
+   */
+  template <typename combiner_t>
+  struct HasExceptions : std::false_type {};
+
+  template <typename T, typename... tail_t, bool aligned_t>
+  struct HasExceptions<Combiner<Concat<T, tail_t...>, aligned_t>> : HasExceptions<Combiner<Concat<tail_t...>, aligned_t>> {};
+
+  template <typename... tail_t, bool aligned_t>
+  struct HasExceptions<Combiner<Concat<Exceptions, tail_t...>, aligned_t>> : std::true_type {};
+
+  /**
+   * @brief worst-case number of bytes of a compressed block of the static outer tokenizer, i.e. for incompressible data:
+   * the parameters of the block (one value per lane in the SIMD case), the values with the width of base_t
+   * and, for PFOR, an exception for each value. Each parameter, the data block and the patch area may be padded
+   * to a word (resp. register) border. The data tail is stored uncompressed and not part of the bound.
+   * Used by CompressParallel to check the slices of the scratch region before the compression.
+   */
+  template <typename format_t>
+  struct CompressedBlockBound {};
+
+  template <typename processingStyle_t, size_t blocksize_t, typename... pads, typename recursion_t, typename combiner_t, typename inputbase_t>
+  struct CompressedBlockBound<
+    ColumnFormat<processingStyle_t, Loop<StaticTokenizer<blocksize_t>, ParameterCalculator<pads...>, recursion_t, combiner_t>, inputbase_t>
+  > {
+    using base_t = typename ColumnFormat<processingStyle_t, Loop<StaticTokenizer<blocksize_t>, ParameterCalculator<pads...>, recursion_t, combiner_t>, inputbase_t>::base_t;
+    /* bytes of a word resp. register of the compressed memory region */
+    static constexpr size_t alignment = sizeof(typename processingStyle_t::base_t) * LaneCount<processingStyle_t>::value;
+    static constexpr size_t parameterBytes =
+      (ParameterBits<pads...>::bits * LaneCount<processingStyle_t>::value + 7) / 8 + ParameterBits<pads...>::count * alignment;
+    static constexpr size_t dataBytes = (blocksize_t * MaxValueBits<recursion_t, base_t>::value + 7) / 8 + alignment;
+    static constexpr size_t exceptionBytes = HasExceptions<combiner_t>::value
+      ? sizeof(uint16_t) + blocksize_t * (sizeof(uint16_t) + sizeof(base_t)) + alignment
+      : 0;
+    static constexpr size_t value = parameterBytes + dataBytes + exceptionBytes;
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_FORMATPROPERTIES_H */
@@ -0,0 +1,160 @@
+/*
+ * File:   Lookup.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_LOOKUP_H
+#define CONVERSION_COLUMNFORMAT_LOOKUP_H
+
+#include "./CompressBlockwise.h"
+#include "./Decompress.h"
+#include "./FormatProperties.h"
+#include <header/preprocessor.h>
+#include <vector>
+
+namespace LCTL {
+
+  /**
+   * @brief random access into formats with blocks of a static tokensize (dynbp, dynforbp, statfordynbp, ...),
+   * whose compressed blocks have a data dependent size.
+   *
+   * During compression, a sidecar index with the byte offset of every blocksPerEntry_t-th compressed block is written.
+   * The i-th value is read by jumping to the index entry of its block and decompressing at most blocksPerEntry_t blocks.
+   * The blocks have to start at word borders (aligned outer combiner) and the format must not carry state from one block
+   * to the next one (i.e. no adaptive parameters like the reference of deltabp), both is checked at compile time. get and gather decompress an index entry into a buffer on the stack, thus an index entry
+   * is limited to maxEntryBytes bytes.
+   *
+   * The compressed memory region is the same as with Compress<format>, thus Decompress<format> can be used for scans.
+   *
+   * @tparam format_t          column format with a static outer tokenizer
+   * @tparam blocksPerEntry_t  number of blocks per index entry, trades the size of the index against the lookup costs
+   */
+  template <typename format, size_t blocksPerEntry_t = 1>
+  struct Lookup{
+
+    using format_t = format;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+    static_assert(staticTokensize > 0, "Lookup needs a static outer tokenizer");
+    static_assert(HasAlignedOuterCombiner<format_t>::value, "Lookup needs an aligned outer combiner");
+    static_assert(!HasAdaptiveReference<format_t>::value, "Lookup needs a format without an adaptive reference");
+    /* number of logical values per index entry */
+    static constexpr size_t entrysize_t = staticTokensize * blocksPerEntry_t;
+    /* maximal size of the buffer for the decompressed values of an index entry on the stack */
+    static constexpr size_t maxEntryBytes = 65536;
+    static_assert(entrysize_t * sizeof(base_t) <= maxEntryBytes, "Lookup decompresses an index entry on the stack, reduce blocksPerEntry_t");
+
+    /**
+     * @brief compresses the column block by block and writes the index
+     *
+     * @param uncompressedMemoryRegion8 uncompressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                number of logical data values
+     * @param compressedMemoryRegion8   memory region, where the compressed output is stored. Castet to uint8_t (single Bytes)
+     * @param index                     output: byte offset of every blocksPerEntry_t-th block in the compressed memory region
+     * @return                          size of the compressed values, number of bytes
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t compress(
+            const uint8_t * uncompressedMemoryRegion8,
+            size_t countInLog,
+            uint8_t * compressedMemoryRegion8,
+            std::vector<size_t> & index)
+    {
+      index.clear();
+      index.reserve((countInLog + entrysize_t - 1) / entrysize_t);
+      auto visitor = [&index](size_t block, size_t position, size_t count, size_t offset) {
+        if (block % blocksPerEntry_t == 0)
+          index.push_back(offset);
+      };
+      const size_t compressedSize = CompressBlockwise<format_t>::apply(uncompressedMemoryRegion8, countInLog, compressedMemoryRegion8, visitor);
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        std::cout << "// index with " << index.size() << " entries\n";
+#     endif
+      return compressedSize;
+    }
+
+    /**
+     * @brief value at position i, only the blocks of one index entry up to the block of position i are decompressed
+     *
+     * @param compressedMemoryRegion8   compressed input data, castet to uint8_t (single Bytes)
+     * @param index                     index written by compress
+     * @param countInLog                number of logical data values of the column
+     * @param i                         logical position of the value
+     * @return                          value at position i
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t get(
+            const uint8_t * compressedMemoryRegion8,
+            const std::vector<size_t> & index,
+            size_t countInLog,
+            size_t i)
+    {
+      /* decompressEntry writes at most the values of one entry */
+      base_t buffer[entrysize_t];
+      const size_t first = decompressEntry(compressedMemoryRegion8, index, countInLog, i, buffer, i / staticTokensize * staticTokensize + staticTokensize);
+      return buffer[i - first];
+    }
+
+    /**
+     * @brief values at the positions (late materialization). Consecutive positions in the same index entry
+     * are read from the same decompressed entry, thus sorted positions decompress each entry at most once.
+     *
+     * @param compressedMemoryRegion8   compressed input data, castet to uint8_t (single Bytes)
+     * @param index                     index written by compress
+     * @param countInLog                number of logical data values of the column
+     * @param positions                 logical positions of the values
+     * @param countPositions            number of positions
+     * @param outBase                   output: values at the positions
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void gather(
+            const uint8_t * compressedMemoryRegion8,
+            const std::vector<size_t> & index,
+            size_t countInLog,
+            const size_t * positions,
+            size_t countPositions,
+            base_t * outBase)
+    {
+      /* decompressEntry writes at most the values of one entry */
+      base_t buffer[entrysize_t];
+      /* no entry is decompressed yet */
+      size_t currentEntry = index.size();
+      size_t first = 0;
+      for (size_t p = 0; p < countPositions; p++) {
+        const size_t i = positions[p];
+        if (i / entrysize_t != currentEntry) {
+          currentEntry = i / entrysize_t;
+          first = decompressEntry(compressedMemoryRegion8, index, countInLog, i, buffer, (currentEntry + 1) * entrysize_t);
+        }
+        outBase[p] = buffer[i - first];
+      }
+      return;
+    }
+
+  private:
+    /**
+     * @brief decompresses the blocks of the index entry of position i up to the logical position end (exclusive)
+     * @return logical position of the first decompressed value
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t decompressEntry(
+            const uint8_t * compressedMemoryRegion8,
+            const std::vector<size_t> & index,
+            size_t countInLog,
+            size_t i,
+            base_t * buffer,
+            size_t end)
+    {
+      const size_t entry = i / entrysize_t;
+      const size_t first = entry * entrysize_t;
+      if (end > countInLog)
+        end = countInLog;
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        std::cout << "// lookup of position " << i << ": index entry " << entry << " at byte " << index[entry] << "\n";
+#     endif
+      /* the blocks of an entry are consecutive in the compressed memory region */
+      Decompress<format_t>::apply(
+        compressedMemoryRegion8 + index[entry],
+        end - first,
+        (uint8_t *) buffer);
+      return first;
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_LOOKUP_H */
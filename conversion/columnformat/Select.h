@@ -0,0 +1,269 @@
+/*
+ * File:   Select.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_SELECT_H
+#define CONVERSION_COLUMNFORMAT_SELECT_H
+
+#include "./DecompressConsume.h"
+#include "../../language/calculation/predicates.h"
+#include "../../language/collate/ColumnFormat.h"
+#include <header/preprocessor.h>
+#include <cstring>
+#include <type_traits>
+
+namespace LCTL {
+
+  /**
+   * @brief output of a selection: list of the positions of matching values
+   */
+  struct PositionList {
+    size_t * positions;
+    size_t count;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE void add(const size_t position, const bool match) {
+      /* branch free: the position is written anyway and overwritten, if it does not match */
+      positions[count] = position;
+      count += match;
+    }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE void add(const size_t position) {
+      positions[count++] = position;
+    }
+  };
+
+  /**
+   * @brief output of a selection: bitmap with one bit per value, the i-th bit is set, if the i-th value matches
+   */
+  struct Bitmap {
+    uint64_t * words;
+    size_t count;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE void add(const size_t position, const bool match) {
+      words[position / 64] |= (uint64_t) match << (position % 64);
+      count += match;
+    }
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE void add(const size_t position) {
+      add(position, true);
+    }
+  };
+
+  /**
+   * @brief consumer of DecompressConsume: range check of the decompressed values of a batch
+   */
+  template <typename base_t, typename output_t>
+  struct SelectConsumer {
+    const base_t lower;
+    const base_t upper;
+    output_t & output;
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE void operator()(const base_t * values, const size_t count, const size_t position) {
+      for (size_t j = 0; j < count; j++)
+        output.add(position + j, values[j] >= lower && values[j] <= upper);
+    }
+  };
+
+  /**
+   * @brief evaluates the range [lower, upper] block by block: each block is decompressed with DecompressConsume
+   * into a buffer in the L1 cache and the values of the buffer are compared, the decompressed column is never written.
+   * Formats with an adaptive reference (delta, deltabp) are supported as in DecompressConsume.
+   *
+   * @tparam format_t  column format with a static outer tokenizer
+   */
+  template <typename format_t>
+  struct SelectBlocks {
+    using base_t = typename format_t::base_t;
+
+    template <typename output_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog,
+            const base_t lower,
+            const base_t upper,
+            output_t & output)
+    {
+      SelectConsumer<base_t, output_t> consumer{lower, upper, output};
+      DecompressConsume<format_t>::apply(compressedMemoryRegion8, countInLog, consumer);
+      return;
+    }
+  };
+
+  template <typename format_t>
+  struct SelectScan : SelectBlocks<format_t> {};
+
+  /**
+   * @brief statbp in the scalar case: the range [lower, upper] is evaluated on the packed words without decompression.
+   * If the bitwidth divides the word size, no value crosses a word border, the constants are replicated to all
+   * fields of a word and compared field-wise with SWAR arithmetics (fields with the highest bit set and subtrahends
+   * without the highest bit, thus the subtraction borrows never from the next field).
+   * The highest bit of each field in the result word is set, iff the field value matches.
+   * Other bitwidths are evaluated block by block.
+   *
+   * @tparam processingStyle_t  scalar TVL Processing Style
+   * @tparam blocksize_t        number of values in a block
+   * @tparam bitwidth_t         bitwidth of the values
+   * @tparam inputbase_t        datatype of the input column
+   */
+  template <typename processingStyle_t, size_t blocksize_t, size_t bitwidth_t, typename inputbase_t>
+  struct SelectScan<
+    ColumnFormat <
+      processingStyle_t,
+      Loop<
+        StaticTokenizer<blocksize_t>,
+        ParameterCalculator<>,
+        Loop<
+          StaticTokenizer<1>,
+          ParameterCalculator<>,
+          Encoder<Token, Value<size_t, bitwidth_t>>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >,
+        Combiner<Token, LCTL_ALIGNED>
+      >,
+      inputbase_t
+    >
+  > {
+    using format_t = ColumnFormat <
+      processingStyle_t,
+      Loop<
+        StaticTokenizer<blocksize_t>,
+        ParameterCalculator<>,
+        Loop<
+          StaticTokenizer<1>,
+          ParameterCalculator<>,
+          Encoder<Token, Value<size_t, bitwidth_t>>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >,
+        Combiner<Token, LCTL_ALIGNED>
+      >,
+      inputbase_t
+    >;
+    using base_t = typename format_t::base_t;
+    using word_t = typename format_t::compressedbase_t;
+    static constexpr size_t wordbits = sizeof(word_t) * 8;
+    static constexpr bool packed =
+      std::is_same<typename processingStyle_t::base_t, typename processingStyle_t::vector_t>::value &&
+      std::is_unsigned<base_t>::value &&
+      bitwidth_t > 0 && bitwidth_t <= wordbits && wordbits % bitwidth_t == 0;
+    /* fields of bitwidth_t bits: mask of one field, lowest bit of each field, highest bit of each field */
+    static constexpr word_t fieldmask = bitwidth_t >= wordbits ? (word_t) ~(word_t) 0 : (word_t) (((word_t) 1 << (bitwidth_t % wordbits)) - 1);
+    static constexpr word_t lowbits = (word_t) ((word_t) ~(word_t) 0 / fieldmask);
+    static constexpr word_t highbits = (word_t) (lowbits << ((bitwidth_t - 1) % wordbits));
+
+    /**
+     * @brief highest bit of each field is set, iff the field value in x is greater or equal to the field value in constant
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static word_t greaterEqual(const word_t x, const word_t constant) {
+      const word_t lowerBitsGreaterEqual = (word_t) ((word_t) (x | highbits) - (word_t) (constant & (word_t) ~highbits));
+      return (word_t) (((x & (word_t) ~constant) | ((word_t) ~(x ^ constant) & lowerBitsGreaterEqual)) & highbits);
+    }
+
+    template <typename output_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog,
+            const base_t lower,
+            const base_t upper,
+            output_t & output)
+    {
+      if (!packed) {
+        SelectBlocks<format_t>::template apply<output_t>(compressedMemoryRegion8, countInLog, lower, upper, output);
+        return;
+      }
+      const size_t countPacked = countInLog / blocksize_t * blocksize_t;
+      const word_t * words = (const word_t *) compressedMemoryRegion8;
+      const size_t countWords = countPacked * bitwidth_t / wordbits;
+      /* constants replicated to all fields, upper + 1 as exclusive upper limit */
+      if ((uint64_t) lower <= (uint64_t) fieldmask) {
+        const bool checkLower = lower > 0;
+        const bool checkUpper = (uint64_t) upper < (uint64_t) fieldmask;
+        const word_t lowerFields = (word_t) (lowbits * (word_t) lower);
+        const word_t upperFields = (word_t) (lowbits * (word_t) (checkUpper ? upper + 1 : 0));
+#       if LCTL_VERBOSEDECOMPRESSIONCODE
+          std::cout << "// packed selection of " << countPacked << " values with " << bitwidth_t << " bits\n";
+#       endif
+        for (size_t w = 0; w < countWords; w++) {
+          const word_t x = words[w];
+          word_t match = highbits;
+          if (checkLower)
+            match &= greaterEqual(x, lowerFields);
+          if (checkUpper)
+            match &= (word_t) ~greaterEqual(x, upperFields);
+          uint64_t matches = (uint64_t) match;
+          while (matches) {
+            output.add(w * (wordbits / bitwidth_t) + (size_t) __builtin_ctzll(matches) / bitwidth_t);
+            matches &= matches - 1;
+          }
+        }
+      }
+      /* data tail in uncompressed form */
+      const uint8_t * tail8 = compressedMemoryRegion8 + countWords * sizeof(word_t);
+      for (size_t i = countPacked; i < countInLog; i++) {
+        base_t value;
+        std::memcpy(&value, tail8 + (i - countPacked) * sizeof(base_t), sizeof(base_t));
+        output.add(i, value >= lower && value <= upper);
+      }
+      return;
+    }
+  };
+
+  /**
+   * @brief selection on a compressed column: evaluates a comparison or range predicate (LCTL/language/calculation/predicates.h)
+   * and writes the positions of the matching values or a bitmap, without writing the decompressed column.
+   * Scalar statbp columns are evaluated on the packed words, other formats with a static outer tokenizer block by block
+   * (see SelectScan). Formats with a data dependent outer tokenizer (rle, varintgb, streamvbyte, simple8b) are rejected
+   * at compile time by DecompressConsume.
+   *
+   * @tparam format_t     column format
+   * @tparam predicate_t  Equal, Less, LessEqual, Greater, GreaterEqual or Between
+   */
+  template <typename format, typename predicate_t>
+  struct Select{
+
+    using format_t = format;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+
+    /**
+     * @param compressedMemoryRegion8 compressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog              number of logical data values
+     * @param positions               output: ascending positions of the matching values, space for countInLog positions
+     * @param constant1               first constant of the predicate
+     * @param constant2               second constant of the predicate (Between)
+     * @return                        number of matching values
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t positions(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog,
+            size_t * positions,
+            const base_t constant1,
+            const base_t constant2 = 0)
+    {
+      PositionList output{positions, 0};
+      base_t lower, upper;
+      if (predicate_t::range(constant1, constant2, lower, upper))
+        SelectScan<format_t>::apply(compressedMemoryRegion8, countInLog, lower, upper, output);
+      return output.count;
+    }
+
+    /**
+     * @param compressedMemoryRegion8 compressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog              number of logical data values
+     * @param bitmap                  output: one bit per value, (countInLog + 63) / 64 words
+     * @param constant1               first constant of the predicate
+     * @param constant2               second constant of the predicate (Between)
+     * @return                        number of matching values
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t bitmap(
+            const uint8_t * compressedMemoryRegion8,
+            size_t countInLog,
+            uint64_t * bitmap,
+            const base_t constant1,
+            const base_t constant2 = 0)
+    {
+      std::memset(bitmap, 0, (countInLog + 63) / 64 * sizeof(uint64_t));
+      Bitmap output{bitmap, 0};
+      base_t lower, upper;
+      if (predicate_t::range(constant1, constant2, lower, upper))
+        SelectScan<format_t>::apply(compressedMemoryRegion8, countInLog, lower, upper, output);
+      return output.count;
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_SELECT_H */
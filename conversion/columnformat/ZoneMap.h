@@ -0,0 +1,142 @@
+/*
+ * File:   ZoneMap.h
+ */
+
+#ifndef CONVERSION_COLUMNFORMAT_ZONEMAP_H
+#define CONVERSION_COLUMNFORMAT_ZONEMAP_H
+
+#include "./CompressBlockwise.h"
+#include "./FormatProperties.h"
+#include "../../codegeneration/Reduction.h"
+#include <header/preprocessor.h>
+#include <vector>
+
+namespace LCTL {
+
+  /**
+   * @brief zone of blocks: minimum, maximum and number of the values,
+   * and the byte offset of the first compressed block in the compressed memory region
+   *
+   * @tparam base_t  datatype of the values
+   */
+  template <typename base_t>
+  struct Zone{
+    base_t minimum;
+    base_t maximum;
+    size_t count;
+    size_t offset;
+  };
+
+  /**
+   * @brief consecutive values of the column, which have to be decompressed to evaluate a predicate:
+   * logical position of the first value, number of values, byte offset in the compressed memory region
+   */
+  struct BlockRange{
+    size_t position;
+    size_t count;
+    size_t offset;
+  };
+
+  /**
+   * @brief zone maps for formats with blocks of a static tokensize (dynbp, dynforbp, statfordynbp, ...).
+   * During compression, the minimum, the maximum and the number of the values of each zone of blocksPerZone_t blocks
+   * are calculated with the reductions of LCTL/codegeneration/Reduction.h and written to a side structure.
+   * A range predicate is evaluated on the zones, only the block ranges of zones overlapping the predicate range
+   * have to be decompressed, i.e. with Decompress<format>::apply(compressed + range.offset, range.count, out).
+   * The blocks have to start at word borders (aligned outer combiner) and the format must not carry state from one block
+   * to the next one (i.e. no adaptive parameters like the reference of deltabp), both is checked at compile time.
+   *
+   * The minimum and the maximum of a block are calculated in an extra pass over the uncompressed block right before it is
+   * compressed, thus the block is read from the L1 cache. The block parameters of the format can not be reused:
+   * they are calculated inside the generated compression code and not returned by Compress, and most formats calculate
+   * neither the minimum nor the maximum (i.e. dynbp only the bitwidth of the maximum).
+   *
+   * @tparam format_t         column format with a static outer tokenizer
+   * @tparam blocksPerZone_t  number of blocks per zone
+   */
+  template <typename format, size_t blocksPerZone_t = 1>
+  struct ZoneMap{
+
+    using format_t = format;
+    using base_t = typename format_t::base_t;
+    static constexpr size_t staticTokensize = format_t::staticTokensize;
+    static_assert(staticTokensize > 0, "ZoneMap needs a static outer tokenizer");
+    static_assert(HasAlignedOuterCombiner<format_t>::value, "ZoneMap needs an aligned outer combiner");
+    static_assert(!HasAdaptiveReference<format_t>::value, "ZoneMap needs a format without an adaptive reference");
+    /* number of logical values per zone */
+    static constexpr size_t zonesize_t = staticTokensize * blocksPerZone_t;
+
+    /**
+     * @brief compresses the column block by block and writes the zone map
+     *
+     * @param uncompressedMemoryRegion8 uncompressed input data, castet to uint8_t (single Bytes)
+     * @param countInLog                number of logical data values
+     * @param compressedMemoryRegion8   memory region, where the compressed output is stored. Castet to uint8_t (single Bytes)
+     * @param zones                     output: one zone per blocksPerZone_t blocks
+     * @return                          size of the compressed values, number of bytes
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t compress(
+            const uint8_t * uncompressedMemoryRegion8,
+            size_t countInLog,
+            uint8_t * compressedMemoryRegion8,
+            std::vector<Zone<base_t>> & zones)
+    {
+      const base_t * inBase = (const base_t *) uncompressedMemoryRegion8;
+      zones.clear();
+      zones.reserve((countInLog + zonesize_t - 1) / zonesize_t);
+      auto visitor = [inBase, &zones](size_t block, size_t position, size_t count, size_t offset) {
+        const base_t minimum = Reduction<base_t>::minReduce(inBase + position, count);
+        const base_t maximum = Reduction<base_t>::maxReduce(inBase + position, count);
+        if (block % blocksPerZone_t == 0)
+          zones.push_back(Zone<base_t>{minimum, maximum, 0, offset});
+        Zone<base_t> & zone = zones.back();
+        zone.minimum = minimum < zone.minimum ? minimum : zone.minimum;
+        zone.maximum = maximum > zone.maximum ? maximum : zone.maximum;
+        zone.count += count;
+      };
+      const size_t compressedSize = CompressBlockwise<format_t>::apply(uncompressedMemoryRegion8, countInLog, compressedMemoryRegion8, visitor);
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        std::cout << "// zone map with " << zones.size() << " zones\n";
+#     endif
+      return compressedSize;
+    }
+
+    /**
+     * @brief block ranges, which can contain values v with lower <= v <= upper.
+     * Consecutive zones are merged to one block range.
+     *
+     * @param zones   zone map written by compress
+     * @param lower   lower limit of the predicate range (inclusive)
+     * @param upper   upper limit of the predicate range (inclusive)
+     * @param ranges  output: block ranges in ascending order
+     * @return        number of values in the block ranges
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t candidates(
+            const std::vector<Zone<base_t>> & zones,
+            const base_t lower,
+            const base_t upper,
+            std::vector<BlockRange> & ranges)
+    {
+      ranges.clear();
+      size_t position = 0;
+      size_t countCandidates = 0;
+      /* the last block range ends in the previous zone and can be extended */
+      bool extend = false;
+      for (const Zone<base_t> & zone : zones) {
+        if (zone.maximum >= lower && zone.minimum <= upper) {
+          if (extend)
+            ranges.back().count += zone.count;
+          else
+            ranges.push_back(BlockRange{position, zone.count, zone.offset});
+          countCandidates += zone.count;
+          extend = true;
+        } else
+          extend = false;
+        position += zone.count;
+      }
+      return countCandidates;
+    }
+  };
+}
+
+#endif /* CONVERSION_COLUMNFORMAT_ZONEMAP_H */
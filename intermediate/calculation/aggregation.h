@@ -11,7 +11,10 @@
 #include "../../language/calculation/literals.h"
 #include "../../Collections.h"
 #include "../../Definitions.h"
+#include "../../codegeneration/Reduction.h"
 #include <header/preprocessor.h>
+#include <cstdint>
+#include <type_traits>
 
 /*
  * The current status of the code is not usable for runtime known tokensizes  and has to be extended. 
@@ -48,11 +51,11 @@ namespace LCTL {
       const size_t tokensize, 
       std::tuple<parameters_t...> parameters) 
     {
-        const base_t * ret = apply_(inBase, inBase+1);
+        const base_t ret = Reduction<base_t>::maxReduce(inBase, I);
 #       if LCTL_VERBOSECODE
-          std::cout << (uint64_t) *ret;
+          std::cout << (uint64_t) ret;
 #       endif
-        return *ret;
+        return ret;
     }
   };
 
@@ -90,11 +93,139 @@ namespace LCTL {
         const size_t tokensize, 
         std::tuple<parameter_t...> parameters) 
       {
-          const T * ret = apply_(inBase, inBase+1);
+          const T ret = Reduction<T>::minReduce(inBase, I);
 #       if LCTL_VERBOSECODE
-          std::cout << (uint64_t) *ret;
+          std::cout << (uint64_t) ret;
 #       endif         
-          return *ret;
+          return ret;
+      }
+  };
+
+  /**
+   * @brief sum of the values of a block, calculated in a 64 bit accumulator (signed values are sign extended) and casted to base_t
+   *
+   * @tparam T            Token
+   * @tparam tokensize_t  number of values of the block
+   * @tparam base_t       datatype of the values
+   */
+  template <typename T, class tokensize_t, typename base_t, typename parameternames_t = List<>>
+  struct SumIR {
+      using inverse = SumIR<T, tokensize_t, base_t, parameternames_t>;
+  };
+
+  template <size_t I, typename base_t>
+  struct SumIR<Token, Value<size_t, I>, base_t> {
+      using inverse = SumIR<Token, Value<size_t, I>, base_t>;
+
+      template <typename T>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t sum(const T * inBase) {
+          uint64_t ret = 0;
+          for (size_t i = 0; i < I; i++)
+            ret += (uint64_t) inBase[i];
+          return ret;
+      }
+
+      template <typename T, typename ... parameter_t>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static const T apply(
+        const T * inBase, 
+        const size_t tokensize, 
+        std::tuple<parameter_t...> parameters) 
+      {
+          const T ret = (T) sum(inBase);
+#       if LCTL_VERBOSECODE
+          std::cout << (uint64_t) ret;
+#       endif         
+          return ret;
+      }
+  };
+
+  /**
+   * @brief average of the values of a block, rounded down (towards negative infinity for signed values)
+   *
+   * @tparam T            Token
+   * @tparam tokensize_t  number of values of the block
+   * @tparam base_t       datatype of the values
+   */
+  template <typename T, class tokensize_t, typename base_t, typename parameternames_t = List<>>
+  struct AvgIR {
+      using inverse = AvgIR<T, tokensize_t, base_t, parameternames_t>;
+  };
+
+  template <size_t I, typename base_t>
+  struct AvgIR<Token, Value<size_t, I>, base_t> {
+      using inverse = AvgIR<Token, Value<size_t, I>, base_t>;
+
+      template <typename T, typename ... parameter_t>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static const T apply(
+        const T * inBase, 
+        const size_t tokensize, 
+        std::tuple<parameter_t...> parameters) 
+      {
+          const T ret = (T) incremental(inBase);
+#       if LCTL_VERBOSECODE
+          std::cout << (int64_t) ret;
+#       endif         
+          return ret;
+      }
+
+      /**
+       * @brief the sum of I values of a 64 bit datatype might overflow, thus the quotients and remainders of the division
+       * by I are summed separately. Signed values are accumulated in int64_t (sign extended), the division truncates towards
+       * zero, thus a negative sum of the remainders is rounded down afterwards.
+       */
+      template <typename T>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type incremental(const T * inBase) {
+          using accumulator_t = typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type;
+          constexpr accumulator_t count = (accumulator_t) I;
+          accumulator_t quotient = 0, remainder = 0;
+          for (size_t i = 0; i < I; i++) {
+            quotient += (accumulator_t) inBase[i] / count;
+            remainder += (accumulator_t) inBase[i] % count;
+          }
+          accumulator_t ret = quotient + remainder / count;
+          if (remainder < (accumulator_t) 0 && remainder % count != 0)
+            ret--;
+          return ret;
+      }
+  };
+
+  /**
+   * @brief percentile of the values of a block, the calculation itself is implemented as part of the bitwidth calculation
+   * (see Bitwidth<PercentileIR<...>> in language/calculation/aggregation.h)
+   *
+   * @tparam T            Token
+   * @tparam tokensize_t  number of values of the block
+   * @tparam base_t       datatype of the values
+   * @tparam percent_t    percentage of values, which are covered
+   */
+  template <typename T, class tokensize_t, typename base_t, size_t percent_t>
+  struct PercentileIR {};
+
+  /**
+   * @brief last value of a block, i.e. the reference value for the next block of a delta format.
+   * In the decompression direction, the last value is read from the decompressed block.
+   *
+   * @tparam T            Token
+   * @tparam tokensize_t  number of values of the block
+   * @tparam base_t       datatype of the values
+   */
+  template <typename T, class tokensize_t, typename base_t>
+  struct LastIR {};
+
+  template <size_t I, typename base_t>
+  struct LastIR<Token, Value<size_t, I>, base_t> {
+      using inverse = LastIR<Token, Value<size_t, I>, base_t>;
+
+      template <typename T, typename ... parameter_t>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static const T apply(
+        const T * inBase, 
+        const size_t tokensize, 
+        std::tuple<parameter_t...> parameters) 
+      {
+#       if LCTL_VERBOSECODE
+          std::cout << (uint64_t) inBase[I - 1];
+#       endif         
+          return inBase[I - 1];
       }
   };
 }
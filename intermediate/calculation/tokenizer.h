@@ -0,0 +1,65 @@
+/*
+ * File:   tokenizer.h
+ */
+
+#ifndef LCTL_INTERMEDIATE_CALCULATION_TOKENIZER_H
+#define LCTL_INTERMEDIATE_CALCULATION_TOKENIZER_H
+
+#include "../../language/calculation/literals.h"
+#include "../../language/collate/Concepts.h"
+#include "../../Definitions.h"
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  /**
+   * @brief calculation rule for the selector of a SwitchTokenizer:
+   * index of the first case, such that the next tokensize_t values fit into bitwidth_t bits.
+   * Values, which are checked for a case, need not to be checked again for the following cases,
+   * because the bitwidths increase and the tokensizes decrease.
+   * If the next value does not fit into the bitwidth of any case, the number of cases is returned
+   * as an invalid selector, the generator of the SwitchTokenizer stops the compression.
+   *
+   * @tparam base_t    datatype of input column
+   * @tparam cases_t   TokenizerCase<tokensize_t, bitwidth_t>
+   */
+  template <typename base_t, typename... cases_t>
+  struct SelectTokenizerCaseIR{};
+
+  template <typename base_t, size_t... tokensize_t, size_t... bitwidth_t>
+  struct SelectTokenizerCaseIR<base_t, TokenizerCase<tokensize_t, bitwidth_t>...> {
+    static constexpr size_t tokensizes[] = {tokensize_t...};
+    static constexpr size_t bitwidths[] = {bitwidth_t...};
+    static constexpr size_t numberOfCases = sizeof...(tokensize_t);
+
+    /**
+     * @param inBase      uncompressed input data
+     * @param tokensize   number of remaining input values
+     * @param parameters  runtime parameters, not used
+     * @return            index of the selected case, numberOfCases if the next value fits into no case
+     */
+    template<typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t apply(
+      const base_t * inBase,
+      const size_t tokensize,
+      std::tuple<parameters_t...> parameters)
+    {
+      /* number of values at the beginning of inBase, which fit into the bitwidth of the current case */
+      size_t fitting = 0;
+      for (size_t c = 0; c < numberOfCases; c++) {
+        if (tokensizes[c] > tokensize)
+          continue;
+        while (fitting < tokensizes[c] && (bitwidths[c] >= sizeof(base_t)*8 || (inBase[fitting] >> bitwidths[c]) == 0))
+          fitting++;
+        if (fitting >= tokensizes[c]) {
+#         if LCTL_VERBOSECODE
+            std::cout << c;
+#         endif
+          return (base_t) c;
+        }
+      }
+      return (base_t) numberOfCases;
+    }
+  };
+}
+#endif /* LCTL_INTERMEDIATE_CALCULATION_TOKENIZER_H */
@@ -17,6 +17,48 @@ namespace LCTL {
   
   template <>
   struct Concat<LCTL::Token>{};
+
+  /**
+   * @brief Combine function of a combiner with several output tracks.
+   * Each track gets its own combine function, i.e.
+   * Tracks<Concat<String<decltype("bitwidth"_tstr)>>, Concat<Token>>
+   * writes the bitwidth of each block to a descriptor track and the data to a data track.
+   * At the moment, exactly two tracks are supported: first the descriptors (parameters), second the data (tokens).
+   * 
+   * @tparam T... one combine function per track
+   */
+  template <typename ...T>
+  struct Tracks{};
+
+  /**
+   * @brief Combine function of an outer combiner, which concats the parameter name_t of each token of the inner loop
+   * (i.e. 4 times 2 bits for the byte lengths of VarintGB), followed by the encoded tokens
+   * 
+   * @tparam name_t  name of a parameter of the inner loop
+   * @tparam T...    Token
+   */
+  template <typename name_t, typename ...T>
+  struct MultipleConcat{};
+
+  /**
+   * @brief Element of a concat combine function behind the Token: exception list (patch area) of a patched format (PFOR).
+   * Values with more bits than the bitwidth of the block are encoded with their lowest bits, 
+   * their positions and higher bits are stored in the patch area behind the block.
+   */
+  struct Exceptions{};
+
+  /**
+   * @brief Combine function of a loop of single values, which are written into one bit stream 
+   * without their leading and trailing zeros (Gorilla), i.e. Combiner<MeaningfulBits<Token>, LCTL_UNALIGNED>.
+   * Each value is written with the control bits
+   * 0 (value is 0), 10 (meaningful bits fit into the window of the previous value) or
+   * 11 (5 bits number of leading zeros, 6 bits number of meaningful bits minus one, new window),
+   * followed by the meaningful bits.
+   * 
+   * @tparam T  Token
+   */
+  template <typename T>
+  struct MeaningfulBits{};
     
 }
 
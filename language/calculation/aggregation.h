@@ -12,6 +12,7 @@
 #include "../../Collections.h"
 #include "../../Definitions.h"
 #include "../../intermediate/calculation/aggregation.h"
+#include "../../codegeneration/Reduction.h"
 #include <header/preprocessor.h>
 
 namespace LCTL {
@@ -28,9 +29,9 @@ namespace LCTL {
       std::tuple<parameters_t...> parameter ) 
     {
 #       if  LCTL_VERBOSECODE
-          std::cout << "32 - __builtin_clz(";
+          std::cout << "blockBitwidth(";
 #       endif
-        const base_t ret = 32 - __builtin_clz(T::apply(inBase, tokensize,parameter));
+        const base_t ret = blockBitwidth(T::apply(inBase, tokensize,parameter));
 #       if LCTL_VERBOSECODE
           std::cout << ")";
 #       endif
@@ -44,9 +45,9 @@ namespace LCTL {
         std::tuple<parameters_t...> parameter ) 
       {
 #         if LCTL_VERBOSECODE
-            std::cout << "32 - __builtin_clz(";
+            std::cout << "blockBitwidth(";
 #         endif
-          const uint32_t ret = 32 - __builtin_clz(T::apply(inBase, tokensize,parameter));
+          const uint32_t ret = blockBitwidth(T::apply(inBase, tokensize,parameter));
 #         if LCTL_VERBOSECODE
           std::cout << ")";
 #         endif
@@ -60,9 +61,9 @@ namespace LCTL {
         std::tuple<parameters_t...> parameter ) 
       {
 #         if LCTL_VERBOSECODE
-            std::cout << "64 - __builtin_clzl(";
+            std::cout << "blockBitwidth(";
 #         endif
-          const uint64_t ret = 64 - __builtin_clzl(T::apply(inBase, tokensize,parameter));
+          const uint64_t ret = blockBitwidth(T::apply(inBase, tokensize,parameter));
 #         if LCTL_VERBOSECODE
             std::cout << ")";
 #         endif
@@ -75,7 +76,7 @@ namespace LCTL {
         const size_t tokensize, 
         std::tuple<parameters_t...> parameter) 
       {
-          base_t ret = 32 - __builtin_clz(T::apply(inBase, tokensize,parameter));
+          base_t ret = blockBitwidth(T::apply(inBase, tokensize,parameter));
           return ret;
       }
 
@@ -86,7 +87,7 @@ namespace LCTL {
         const size_t tokensize, 
         std::tuple<parameters_t...> parameter) 
       {
-          const uint32_t ret = 32 - __builtin_clz(T::apply(inBase, tokensize,parameter));
+          const uint32_t ret = blockBitwidth(T::apply(inBase, tokensize,parameter));
           return ret;
       }
 
@@ -96,7 +97,7 @@ namespace LCTL {
         const size_t tokensize, 
         std::tuple<parameters_t...> parameter) 
       {
-          const uint64_t ret = 64 - __builtin_clzl(T::apply(inBase, tokensize,parameter));
+          const uint64_t ret = blockBitwidth(T::apply(inBase, tokensize,parameter));
           return ret;
       }
   };
@@ -122,13 +123,11 @@ namespace LCTL {
         const size_t tokensize, 
         std::tuple<parameters_t...> parameter) 
       {
-          base_t orLoop = 0;
-          for (size_t i = 0; i < tokensize_t; i++)
-              orLoop |= *(inBase + i);
+          const base_t orLoop = Reduction<base_t>::orReduce(inBase, tokensize_t);
 #         if LCTL_VERBOSECODE
-            std::cout << "32 - __builtin_clz( " << (uint64_t) orLoop;
+            std::cout << "blockBitwidth( " << (uint64_t) orLoop;
 #         endif
-          const base_t ret = 32 - __builtin_clz(orLoop);
+          const base_t ret = blockBitwidth(orLoop);
 #         if LCTL_VERBOSECODE
             std::cout << " ) ( = " << (uint64_t) ret << " )";
 #         endif
@@ -157,13 +156,11 @@ namespace LCTL {
         const size_t tokensize, 
         std::tuple<parameters_t...> parameter) 
       {
-          uint64_t orLoop = 0;
-          for (size_t i = 0; i < tokensize_t; i++)
-              orLoop |= *(inBase + i);
+          const uint64_t orLoop = Reduction<uint64_t>::orReduce(inBase, tokensize_t);
 #if       LCTL_VERBOSECODE
-            std::cout << "64 - __builtin_clz(";
+            std::cout << "blockBitwidth(";
 #         endif
-          const uint64_t ret = 64 - __builtin_clz(orLoop);
+          const uint64_t ret = blockBitwidth(orLoop);
 #         if LCTL_VERBOSECODE
             std::cout << ")";
 #         endif
@@ -181,9 +178,66 @@ namespace LCTL {
         const size_t tokensize, 
         std::tuple<parameters_t...> parameter) 
         {
-          const uint32_t ret = 32 - __builtin_clz(*inBase);
+          const uint32_t ret = blockBitwidth(*inBase);
 #if       LCTL_VERBOSECODE
-            std::cout << "32 - __builtin_clz(" << ret << ")";
+            std::cout << "blockBitwidth(" << ret << ")";
+#         endif
+          return ret;
+      }
+  };
+
+  /**
+   * @brief Percentile of a block, i.e. Bitwidth<Percentile<Token, 90>> is the smallest bitwidth, 
+   * such that at least 90 percent of the values of the block can be encoded with this bitwidth (see pfor.h)
+   *
+   * @tparam T          Token
+   * @tparam percent_t  percentage of values, which are covered
+   */
+  template <typename T, size_t percent_t>
+  struct Percentile {};
+
+  /**
+   * @brief smallest bitwidth covering percent_t percent of the values of a block: 
+   * histogram of the bitwidths of all values and prefix sum over the histogram
+   */
+  template <
+      size_t tokensize_t,
+      typename base_t,
+      size_t percent_t,
+      typename parameternames_t
+  >
+  struct Bitwidth<
+    PercentileIR<
+      Token, 
+      Value<size_t, tokensize_t>, 
+      base_t, 
+      percent_t
+    >, 
+    parameternames_t> {
+    
+      template<typename... parameters_t>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static const base_t apply(
+        const base_t * & inBase, 
+        const size_t tokensize, 
+        std::tuple<parameters_t...> parameter) 
+      {
+          size_t histogram[sizeof(base_t) * 8 + 1] = {0};
+          for (size_t i = 0; i < tokensize_t; i++) {
+            const uint64_t value = (uint64_t) *(inBase + i);
+            histogram[usedBits(value)]++;
+          }
+          /* number of values, which have to be covered */
+          const size_t covered = (tokensize_t * percent_t + 99) / 100;
+          /* at least one bit: the code generation of a switch value skips the case of a zero bitwidth */
+          size_t count = histogram[0];
+          base_t ret = 1;
+          for (; ret < sizeof(base_t) * 8; ret++) {
+            count += histogram[ret];
+            if (count >= covered)
+              break;
+          }
+#         if LCTL_VERBOSECODE
+            std::cout << "percentile(" << percent_t << ") bitwidth ( = " << (uint64_t) ret << " )";
 #         endif
           return ret;
       }
@@ -192,12 +246,31 @@ namespace LCTL {
   template <typename T>
   struct Min{};
 
+  /**
+   * @brief last value of a block, i.e. AdaptiveParameterDefinition<ParameterDefinition<String<decltype("p"_tstr)>, Last<Token>, ...>, ...>
+   * is the reference value of the next block
+   */
+  template <typename T>
+  struct Last{};
+
+  /**
+   * @brief average of a block (rounded down), the Analyzer replaces it with AvgIR
+   */
   template <typename T>
   struct Avg {};
 
+  /**
+   * @brief sum of a block (modulo 2^(sizeof(base_t) * 8)), the Analyzer replaces it with SumIR
+   */
   template <typename T>
   struct Sum {};
 
+  /**
+   * @brief number of values, i.e. Aggregate<format, Count<Token>> (LCTL/conversion/columnformat/Aggregate.h)
+   */
+  template <typename T>
+  struct Count {};
+
   template <typename T>
   using BITWIDTH = Bitwidth<T>;
   template <typename T>
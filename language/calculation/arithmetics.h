@@ -273,6 +273,55 @@ namespace LCTL {
       }
   };
 
+  /**
+   * @brief Difference of each value of a block to the value distance_t positions before (D1: distance_t = 1, D4: distance_t = 4).
+   * The first distance_t values of a block are the differences to ref_t, i.e. to the last value of the previous block.
+   * The logical value depends on the position in the block, thus it is calculated for a whole block 
+   * by the code generation (see UnrolledLoop_Tokensize1_WOEncodedParameters_DeltaEncoder_Generator.h),
+   * the decompression is a prefix sum.
+   *
+   * @tparam T           Token
+   * @tparam ref_t       reference value for the first values of a block, i.e. String<decltype("ref"_tstr)>
+   * @tparam distance_t  distance of the subtrahend
+   */
+  template <typename T, typename ref_t, size_t distance_t>
+  struct Delta {
+    /**
+     * @brief differences of the tokensize_t values of a block
+     */
+    template<size_t tokensize_t, typename base_t, typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void apply(
+      const base_t * inBase, 
+      base_t * deltaBase,
+      std::tuple<parameters_t...> parameters)
+    {
+        const base_t reference = (base_t) ref_t::apply(inBase, tokensize_t, parameters);
+        for (size_t i = 0; i < distance_t && i < tokensize_t; i++)
+          deltaBase[i] = (base_t) (inBase[i] - reference);
+        for (size_t i = distance_t; i < tokensize_t; i++)
+          deltaBase[i] = (base_t) (inBase[i] - inBase[i - distance_t]);
+    }
+
+    /**
+     * @brief differences of the current block of a thread and the address of the block in the input column
+     */
+    template<size_t tokensize_t, typename base_t>
+    struct Block {
+      base_t differences[tokensize_t];
+      const base_t * in = nullptr;
+    };
+
+    /**
+     * @brief buffer of the current block: Bitwidth<MaxIR<Delta<...>>> calculates the differences into it for the block parameters,
+     * the encoder of the same block bit packs them from there, thus each difference is calculated once
+     */
+    template<size_t tokensize_t, typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static Block<tokensize_t, base_t> & block()
+    {
+        static thread_local Block<tokensize_t, base_t> current;
+        return current;
+    }
+  };
 }
 
 #endif /* LCTL_LANGUAGE_CALCULATION_ARITHMETICS_H */
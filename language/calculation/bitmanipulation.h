@@ -18,6 +18,9 @@
 #include "../../Definitions.h"
 #include "../../Collections.h"
 #include "aggregation.h"
+#include "arithmetics.h"
+#include <type_traits>
+#include <cstring>
 #include <header/preprocessor.h>
 
 namespace LCTL {
@@ -136,6 +139,316 @@ namespace LCTL {
     }
   };
 
+  template <typename T>
+  struct UnZigZag;
+
+  /**
+   * @brief ZigZag mapping of signed values to unsigned values with small magnitude: 
+   * 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ... ( (v << 1) ^ (v >> (bits - 1)) with an arithmetic right shift).
+   * Thus, signed values with a small absolute value need only a few bits (see zigzagstatbp, zigzagdynbp, zigzagdelta).
+   * The result is the bit pattern of the mapped value in the (possibly signed) datatype base_t.
+   *
+   * @tparam T  term, which is mapped, i.e. Token or Minus<Token, String<decltype("ref"_tstr)>>
+   */
+  template <typename T>
+  struct ZigZag {
+    using inverse = UnZigZag<T>;
+
+    template<typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t map(const base_t value) {
+      using unsigned_t = typename std::make_unsigned<base_t>::type;
+      const unsigned_t v = (unsigned_t) value;
+      return (base_t) ((unsigned_t) (v << 1) ^ (unsigned_t) ((unsigned_t) 0 - (v >> (sizeof(base_t) * 8 - 1))));
+    }
+
+    template<typename base_t, typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t apply(
+      const base_t * inBase, 
+      const size_t tokensize, 
+      std::tuple<parameters_t...> parameters)
+    {
+#       if LCTL_VERBOSECODE
+          std::cout << "zigzag( ";
+#       endif
+        const base_t ret = map(T::apply(inBase, tokensize, parameters));
+#       if LCTL_VERBOSECODE
+          std::cout << " )";
+#       endif
+        return ret;
+    }
+  };
+
+  template <>
+  struct ZigZag<Token> {
+    using inverse = UnZigZag<Token>;
+
+    template<typename base_t, typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t apply(
+      const base_t * inBase, 
+      const size_t tokensize, 
+      std::tuple<parameters_t...> parameters)
+    {
+#       if LCTL_VERBOSECODE
+          std::cout << "zigzag( " << (uint64_t) *inBase << " )";
+#       endif
+        return ZigZag<NIL>::map(*inBase);
+    }
+  };
+
+  /**
+   * @brief Inverse ZigZag mapping: (v >> 1) ^ -(v & 1) with a logical right shift
+   */
+  template <typename T>
+  struct UnZigZag {
+    using inverse = ZigZag<T>;
+
+    template<typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t map(const base_t value) {
+      using unsigned_t = typename std::make_unsigned<base_t>::type;
+      const unsigned_t v = (unsigned_t) value;
+      return (base_t) ((unsigned_t) (v >> 1) ^ (unsigned_t) ((unsigned_t) 0 - (v & 1)));
+    }
+
+    template<typename base_t, typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t apply(
+      const base_t * inBase, 
+      const size_t tokensize, 
+      std::tuple<parameters_t...> parameters)
+    {
+#       if LCTL_VERBOSECODE
+          std::cout << "unzigzag( ";
+#       endif
+        const base_t ret = map(T::apply(inBase, tokensize, parameters));
+#       if LCTL_VERBOSECODE
+          std::cout << " )";
+#       endif
+        return ret;
+    }
+  };
+
+  template <>
+  struct UnZigZag<Token> {
+    using inverse = ZigZag<Token>;
+
+    template<typename base_t, typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t apply(
+      const base_t * inBase, 
+      const size_t tokensize, 
+      std::tuple<parameters_t...> parameters)
+    {
+#       if LCTL_VERBOSECODE
+          std::cout << "unzigzag( " << (uint64_t) *inBase << " )";
+#       endif
+        return UnZigZag<NIL>::map(*inBase);
+    }
+  };
+
+  /* 
+   * ZigZag of a difference (signed delta): the decompression first inverts the ZigZag mapping
+   * of the decoded value and afterwards the difference
+   */
+  template <typename T>
+  struct ZigZag<Minus<Token, T>> {
+    using inverse = Plus<UnZigZag<Token>, T>;
+
+    template<typename base_t, typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t apply(
+      const base_t * inBase, 
+      const size_t tokensize, 
+      std::tuple<parameters_t...> parameters)
+    {
+#       if LCTL_VERBOSECODE
+          std::cout << "zigzag";
+#       endif
+        return ZigZag<NIL>::map(Minus<Token, T>::apply(inBase, tokensize, parameters));
+    }
+  };
+
+  /**
+   * @brief bitwidth of the maximum of ZigZag mapped values: bitwise or of all mapped values of the block,
+   * at least one bit
+   */
+  template <
+      size_t tokensize_t,
+      typename base_t,
+      typename parameternamesmax_t,
+      typename parameternames_t
+  >
+  struct Bitwidth<
+    MaxIR<
+      ZigZag<Token>, 
+      Value<size_t, tokensize_t>, 
+      base_t, 
+      parameternamesmax_t
+    >, 
+    parameternames_t> {
+    
+      template<typename... parameters_t>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static const base_t apply(
+        const base_t * & inBase, 
+        const size_t tokensize, 
+        std::tuple<parameters_t...> parameter) 
+      {
+          uint64_t orLoop = 0;
+          for (size_t i = 0; i < tokensize_t; i++)
+              orLoop |= (typename std::make_unsigned<base_t>::type) ZigZag<NIL>::map(*(inBase + i));
+          const base_t ret = blockBitwidth(orLoop);
+#         if LCTL_VERBOSECODE
+            std::cout << "zigzag bitwidth ( = " << (uint64_t) ret << " )";
+#         endif
+          return ret;
+      }
+  };
+
+  /**
+   * @brief Bitwise XOR of the bit patterns of two terms, i.e. of a value and its predecessor (Gorilla).
+   * base_t can be a floating point datatype, the bit patterns are handled as unsigned integers of the same size.
+   * XOR is its own inverse.
+   *
+   * @tparam T  first term, i.e. Token
+   * @tparam U  second term, i.e. String<decltype("ref"_tstr)>
+   */
+  template <typename T, typename U>
+  struct Xor {
+    using inverse = Xor<T, U>;
+
+    template<typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t map(const base_t value1, const base_t value2) {
+      using bits_t = typename std::conditional<sizeof(base_t) == 8, uint64_t,
+                     typename std::conditional<sizeof(base_t) == 4, uint32_t,
+                     typename std::conditional<sizeof(base_t) == 2, uint16_t, uint8_t>::type>::type>::type;
+      bits_t bits1, bits2;
+      std::memcpy(&bits1, &value1, sizeof(base_t));
+      std::memcpy(&bits2, &value2, sizeof(base_t));
+      bits1 ^= bits2;
+      base_t ret;
+      std::memcpy(&ret, &bits1, sizeof(base_t));
+      return ret;
+    }
+
+    template<typename base_t, typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t apply(
+      const base_t * inBase, 
+      const size_t tokensize, 
+      std::tuple<parameters_t...> parameters)
+    {
+#       if LCTL_VERBOSECODE
+          std::cout << " ( ";
+#       endif
+        const base_t ret1 = T::apply(inBase, tokensize, parameters);
+#       if LCTL_VERBOSECODE
+          std::cout << " ^ ";
+#       endif
+        const base_t ret2 = U::apply(inBase, tokensize, parameters);
+#       if LCTL_VERBOSECODE
+          std::cout << " )";
+#       endif
+        return map(ret1, ret2);
+    }
+  };
+
+  template <typename U>
+  struct Xor<Token, U> {
+    using inverse = Xor<Token, U>;
+
+    template<typename base_t, typename... parameters_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static base_t apply(
+      const base_t * inBase, 
+      const size_t tokensize, 
+      std::tuple<parameters_t...> parameters)
+    {
+#       if LCTL_VERBOSECODE
+          std::cout << "( " << *inBase << " ^ ";
+#       endif
+        const base_t ret = Xor<NIL, NIL>::map(*inBase, (base_t) U::apply(inBase, tokensize, parameters));
+#       if LCTL_VERBOSECODE
+          std::cout << " )";
+#       endif
+        return ret;
+    }
+  };
+
+
+  /**
+   * @brief bitwidth of the maximal difference of a block: bitwise or of all differences, at least one bit
+   */
+  template <
+      typename ref_t,
+      size_t distance_t,
+      size_t tokensize_t,
+      typename base_t,
+      typename parameternamesmax_t,
+      typename parameternames_t
+  >
+  struct Bitwidth<
+    MaxIR<
+      Delta<Token, ref_t, distance_t>, 
+      Value<size_t, tokensize_t>, 
+      base_t, 
+      parameternamesmax_t
+    >, 
+    parameternames_t> {
+    
+      template<typename... parameters_t>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static const base_t apply(
+        const base_t * & inBase, 
+        const size_t tokensize, 
+        std::tuple<parameters_t...> parameter) 
+      {
+          /* the differences are stored in the block buffer of Delta, the encoder of the block packs them from there */
+          auto & block = Delta<Token, ref_t, distance_t>::template block<tokensize_t, base_t>();
+          Delta<Token, ref_t, distance_t>::template apply<tokensize_t>(inBase, block.differences, parameter);
+          block.in = inBase;
+          uint64_t orLoop = 0;
+          for (size_t i = 0; i < tokensize_t; i++)
+              orLoop |= (uint64_t) block.differences[i];
+          const base_t ret = blockBitwidth(orLoop);
+#         if LCTL_VERBOSECODE
+            std::cout << "delta bitwidth ( = " << (uint64_t) ret << " )";
+#         endif
+          return ret;
+      }
+  };
+
+  /**
+   * @brief bitwidth of the range of a block, i.e. Bitwidth<Minus<Max<Token>, String<decltype("min"_tstr)>>> in dynforbp:
+   * the values of the block are reduced by the minimum and the bitwidth of the largest difference is calculated for each width of base_t,
+   * at least one bit (a block of equal values)
+   */
+  template <
+      size_t tokensize_t,
+      typename base_t,
+      typename parameternamesmax_t,
+      typename reference_t,
+      typename parameternames_t
+  >
+  struct Bitwidth<
+    Minus<
+      MaxIR<
+        Token, 
+        Value<size_t, tokensize_t>, 
+        base_t, 
+        parameternamesmax_t
+      >,
+      reference_t
+    >,
+    parameternames_t> {
+    
+      template<typename... parameters_t>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static const base_t apply(
+        const base_t * & inBase, 
+        const size_t tokensize, 
+        std::tuple<parameters_t...> parameter) 
+      {
+          const base_t reference = (base_t) reference_t::apply(inBase, tokensize, parameter);
+          const base_t maximum = Reduction<base_t>::maxReduce(inBase, tokensize_t);
+          const base_t ret = blockBitwidth((base_t) (maximum - reference));
+#         if LCTL_VERBOSECODE
+            std::cout << "range bitwidth ( = " << (uint64_t) ret << " )";
+#         endif
+          return ret;
+      }
+  };
 }
 
 #endif /* LCTL_LANGUAGE_CALCULATION_BITMANIPULATION_H */
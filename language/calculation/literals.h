@@ -348,7 +348,7 @@ namespace LCTL {
      * @param inBase      pointer compressed or uncompressed data memory region (not needed here)
      * @param tokensize   number of uncompressed values belonging to the same token (not needed here)
      * @param parameters  runtime parameters
-     * @return runtime parameter
+     * @return runtime parameter with the datatype of the parameter (i.e. double for floating point columns)
      * 
      * @todo if we always have pointer, it might be better to return the pointer, not the value itself
      * 
@@ -356,13 +356,13 @@ namespace LCTL {
      * @author: Juliana Hildebrandt
      */
     template<typename base_t, typename... parameters_t>
-    // TODO: might be another datatype, i.e. size_t
-    MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t  apply(
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static 
+    typename std::decay<decltype(*std::get<S>(std::declval<std::tuple<parameters_t...>>()))>::type apply(
       const base_t * & inBase, 
       size_t tokensize, 
       std::tuple<parameters_t...> parameters)
       {           
-        uint64_t dp = *std::get<S>(parameters);//Depointer::apply(std::get<0>(parameters));
+        const auto dp = *std::get<S>(parameters);//Depointer::apply(std::get<0>(parameters));
 #       if LCTL_VERBOSECODE
           std::cout << (uint64_t) dp << "(Position " << S << " )";
 #       endif
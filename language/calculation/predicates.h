@@ -0,0 +1,98 @@
+/*
+ * File:   predicates.h
+ */
+
+#ifndef LCTL_LANGUAGE_CALCULATION_PREDICATES_H
+#define LCTL_LANGUAGE_CALCULATION_PREDICATES_H
+
+#include "../../Definitions.h"
+#include <header/preprocessor.h>
+#include <limits>
+
+namespace LCTL {
+
+  /**
+   * @brief Comparison and range predicates for selections on compressed columns (LCTL/conversion/columnformat/Select.h).
+   * The constants are known at runtime. Each predicate is normalized to an inclusive range [lower, upper] of values,
+   * thus the selection has only to implement range checks, in the compressed domain as well as on decompressed values.
+   * range(...) returns false, if no value can satisfy the predicate.
+   */
+
+  /**
+   * @brief value == constant1
+   */
+  struct Equal {
+    template <typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static bool range(const base_t constant1, const base_t constant2, base_t & lower, base_t & upper) {
+      lower = constant1;
+      upper = constant1;
+      return true;
+    }
+  };
+
+  /**
+   * @brief value < constant1
+   */
+  struct Less {
+    template <typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static bool range(const base_t constant1, const base_t constant2, base_t & lower, base_t & upper) {
+      if (constant1 == std::numeric_limits<base_t>::min())
+        return false;
+      lower = std::numeric_limits<base_t>::min();
+      upper = constant1 - 1;
+      return true;
+    }
+  };
+
+  /**
+   * @brief value <= constant1
+   */
+  struct LessEqual {
+    template <typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static bool range(const base_t constant1, const base_t constant2, base_t & lower, base_t & upper) {
+      lower = std::numeric_limits<base_t>::min();
+      upper = constant1;
+      return true;
+    }
+  };
+
+  /**
+   * @brief value > constant1
+   */
+  struct Greater {
+    template <typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static bool range(const base_t constant1, const base_t constant2, base_t & lower, base_t & upper) {
+      if (constant1 == std::numeric_limits<base_t>::max())
+        return false;
+      lower = constant1 + 1;
+      upper = std::numeric_limits<base_t>::max();
+      return true;
+    }
+  };
+
+  /**
+   * @brief value >= constant1
+   */
+  struct GreaterEqual {
+    template <typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static bool range(const base_t constant1, const base_t constant2, base_t & lower, base_t & upper) {
+      lower = constant1;
+      upper = std::numeric_limits<base_t>::max();
+      return true;
+    }
+  };
+
+  /**
+   * @brief constant1 <= value <= constant2
+   */
+  struct Between {
+    template <typename base_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static bool range(const base_t constant1, const base_t constant2, base_t & lower, base_t & upper) {
+      lower = constant1;
+      upper = constant2;
+      return constant1 <= constant2;
+    }
+  };
+}
+
+#endif /* LCTL_LANGUAGE_CALCULATION_PREDICATES_H */
@@ -16,6 +16,42 @@ namespace LCTL {
   template <size_t S>
   using StaticTokenizer = Size<S>;
   
+  /**
+   * @brief one case of a SwitchTokenizer: tokensize_t values, each of them is encoded with bitwidth_t bits
+   * 
+   * @tparam tokensize_t number of values
+   * @tparam bitwidth_t  bitwidth of each value
+   */
+  template <size_t tokensize_t, size_t bitwidth_t>
+  struct TokenizerCase{};
+
+  /**
+   * @brief Data dependent tokenizer with a small set of compiletime known cases (i.e. Simple-8b).
+   * The tokenizer selects the first case, such that the next tokensize_t values fit into bitwidth_t bits.
+   * The index of this case is a parameter (selector) with the name name_t, encoded with numberOfBits_t bits.
+   * In the case, the bitwidth is a known parameter with the name bitwidthname_t.
+   * Cases have to be ordered by decreasing tokensize and increasing bitwidth, the last case should have tokensize 1.
+   * 
+   * @tparam name_t           name of the selector
+   * @tparam numberOfBits_t   number of bits to encode the selector, i.e. Size<4>
+   * @tparam bitwidthname_t   name of the bitwidth parameter of each case
+   * @tparam cases_t...       TokenizerCase<tokensize_t, bitwidth_t>
+   */
+  template <typename name_t, typename numberOfBits_t, typename bitwidthname_t, typename... cases_t>
+  struct SwitchTokenizer{};
+
+  /**
+   * @brief Data dependent tokenizer for run-length encoding: each token is the maximal run of equal values
+   * at the current position, but at most 2^numberOfBits_t - 1 values.
+   * The length of the run is a parameter with the name name_t, encoded with numberOfBits_t bits.
+   * The tokensize is not known at compiletime (UnknownTokenizerIR).
+   * 
+   * @tparam name_t           name of the run length
+   * @tparam numberOfBits_t   number of bits to encode the run length, i.e. Size<32>
+   */
+  template <typename name_t, typename numberOfBits_t>
+  struct RunTokenizer{};
+
   /**
    * @brief Recursion concept in Collate
    * 
@@ -128,14 +164,19 @@ namespace LCTL {
    * @tparam func_combine  contains a function to combine data and parameters
    * @tparam aligned       defines, if each block starts at a word (resp. register) border or not
    * 
-   * @todo we need a combiner with several output tracks. Each output track has to have its own processing style,
-   * i.e. SIMD for data, scalar for descriptors
+   * Combiners with several output tracks use Tracks<...> as func_combine (see Concat.h),
+   * i.e. Combiner<Tracks<Concat<String<decltype("bitwidth"_tstr)>>, Concat<Token>>, LCTL_ALIGNED>.
+   * 
+   * @todo each output track might have its own processing style, i.e. SIMD for data, scalar for descriptors.
+   * At the moment, all tracks share the processing style of the format.
    * 
    * @date: 26.05.2021 12:00
    * @author: Juliana Hildebrandt
    */
   template<typename func_combine, bool aligned>
-  struct Combiner{};
+  struct Combiner{
+    using func_combine_t = func_combine;
+  };
 }
 
 #endif /* LCTL_LANGUAGE_COLLATE_CONCEPTS_H */
@@ -63,6 +63,22 @@
 #   define PROCESSINGSTYLE avx2<v256<uint64_t>>
 #   define COMPRESSEDBASE uint64_t
 #   define PROCESSINGSTYLESTRING "avx2<v256<uint64_t>>"
+#elif defined(AVX512) && defined(COMPRESSEDBASEBITSIZE) && COMPRESSEDBASEBITSIZE == 8
+#   define PROCESSINGSTYLE avx512<v512<uint8_t>>
+#   define COMPRESSEDBASE uint8_t
+#   define PROCESSINGSTYLESTRING "avx512<v512<uint8_t>>"
+#elif defined(AVX512) && defined(COMPRESSEDBASEBITSIZE) && COMPRESSEDBASEBITSIZE == 16
+#   define PROCESSINGSTYLE avx512<v512<uint16_t>>
+#   define COMPRESSEDBASE uint16_t
+#   define PROCESSINGSTYLESTRING "avx512<v512<uint16_t>>"
+#elif defined(AVX512) && defined(COMPRESSEDBASEBITSIZE) && COMPRESSEDBASEBITSIZE == 32
+#   define PROCESSINGSTYLE avx512<v512<uint32_t>>
+#   define COMPRESSEDBASE uint32_t
+#   define PROCESSINGSTYLESTRING "avx512<v512<uint32_t>>"
+#elif defined(AVX512) && defined(COMPRESSEDBASEBITSIZE) && COMPRESSEDBASEBITSIZE == 64
+#   define PROCESSINGSTYLE avx512<v512<uint64_t>>
+#   define COMPRESSEDBASE uint64_t
+#   define PROCESSINGSTYLESTRING "avx512<v512<uint64_t>>"
 #endif
 
 #if defined(BASEBITSIZE)
@@ -0,0 +1,80 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o aggregate aggregate.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 8;
+    
+    string formatstring = "dynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* data tail of three values */
+    testcaseAggregate < String < decltype("AggregateDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, dynbp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    /* whole blocks without a data tail */
+    testcaseAggregate < String < decltype("AggregateDynBPWithoutTail"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dynbp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringfor = "dynforbp<";
+    formatstringfor.append(PROCESSINGSTYLESTRING);
+    formatstringfor.append(", 1, uint");
+    formatstringfor.append(std::to_string(BASEBITSIZE));
+    formatstringfor.append("_t>");
+    
+    testcaseAggregate < String < decltype("AggregateDynForBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, dynforbp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstringfor);
+    
+    testcaseAggregate < String < decltype("AggregateDynForBPWithoutTail"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dynforbp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstringfor);
+    
+    /* minima of the blocks with the upper half of the bits, the minimum has the width of the input datatype */
+    testcaseAggregate < String < decltype("AggregateDynForBPLargeMinimum"_tstr) >, UPPER / 2 + 1, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, dynforbp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstringfor);
+    
+    string formatstringdelta = "deltabp<";
+    formatstringdelta.append(PROCESSINGSTYLESTRING);
+    formatstringdelta.append(", 1, uint");
+    formatstringdelta.append(std::to_string(BASEBITSIZE));
+    formatstringdelta.append("_t>");
+    
+    /* block by block with the reference of the previous block */
+    testcaseAggregate < String < decltype("AggregateDeltaBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, true, deltabp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstringdelta);
+    
+    testcaseAggregate < String < decltype("AggregateDeltaBPWithoutTail"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, true, deltabp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstringdelta);
+    
+    string formatstringrle = "rle<";
+    formatstringrle.append(PROCESSINGSTYLESTRING);
+    formatstringrle.append(", uint");
+    formatstringrle.append(std::to_string(BASEBITSIZE));
+    formatstringrle.append("_t>");
+    
+    /* sorted data, such that there are runs */
+    testcaseAggregate < String < decltype("AggregateRLE"_tstr) >, 0, UPPER, 1000, true, rle <PROCESSINGSTYLE, BASE> >::apply(
+            argv,
+            formatstringrle);
+  }
+  return 0;
+}
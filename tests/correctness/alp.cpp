@@ -0,0 +1,46 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=100000 -o alp alp.cpp
+ */
+#include <limits>
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 2048;
+    
+    string formatstring = "alp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, double>");
+    
+    /* the data generator creates decimals with two decimal places (integers up to UPPER divided by 100) */
+    testcaseCorrectness < String < decltype("ALP"_tstr) >, 0, UPPER, countInLog, false, alp <PROCESSINGSTYLE, 1, double> >::apply(
+            argv,
+            formatstring);
+    
+    /* values without an exact encoding with exponent and factor of their block are stored as exceptions,
+     * they are spread over several blocks and the data tail */
+    using alp_t = alp <PROCESSINGSTYLE, 1, double>;
+    std::vector<double> withExceptions(alp_t::blocksize * 3 + 17);
+    for (size_t i = 0; i < withExceptions.size(); i++)
+      withExceptions[i] = (double) (i % 10000) / 100;
+    const double exceptions[] = {
+      0.1 + 0.2, 1.0 / 3, std::numeric_limits<double>::quiet_NaN(), 1e300, -1e300,
+      std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), -0.0};
+    for (size_t b = 0; b * alp_t::blocksize < withExceptions.size(); b++)
+      for (size_t e = 0; e < sizeof(exceptions) / sizeof(double); e++) {
+        const size_t i = b * alp_t::blocksize + 1 + 2 * e + b;
+        if (i < withExceptions.size())
+          withExceptions[i] = exceptions[e];
+      }
+    testcaseGivenValues<alp_t>::apply(argv, "Exceptions", withExceptions, formatstring);
+  }
+  return 0;
+}
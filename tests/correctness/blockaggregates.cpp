@@ -0,0 +1,92 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o blockaggregates blockaggregates.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+/* signed input datatype of the same width as BASE */
+using SIGNEDBASE = std::make_signed<BASE>::type;
+
+/* signed values in [-UPPER/2 - 1, UPPER/2], as uint64_t template arguments */
+constexpr uint64_t SIGNEDLOWER = (uint64_t) (- (int64_t) (UPPER / 2) - 1);
+constexpr uint64_t SIGNEDUPPER = UPPER / 2;
+
+/**
+ * @brief zigzagdynbp, which stores the sum and the average of each block as block parameters behind the bitwidth
+ * (Sum<Token> and Avg<Token> are replaced by the Analyzer with SumIR and AvgIR)
+ */
+template <typename processingStyle_t, typename inputDatatype_t = NIL>
+using sumavgdynbp = ColumnFormat <
+  processingStyle_t,
+  Loop<
+    StaticTokenizer<processingStyle_t::vector_helper_t::size_bit::value>,
+    ParameterCalculator<
+      ParameterDefinition<
+        String<decltype("sum"_tstr)>,
+        Sum<Token>, 
+        Size<sizeof(typename processingStyle_t::base_t)*8>
+      >,
+      ParameterDefinition<
+        String<decltype("avg"_tstr)>,
+        Avg<Token>, 
+        Size<sizeof(typename processingStyle_t::base_t)*8>
+      >,
+      ParameterDefinition<
+        String<decltype("bitwidth"_tstr)>,
+        Bitwidth<Max<ZigZag<Token>>>, 
+        Size<sizeof(typename processingStyle_t::base_t)*8>
+      >
+    >,
+    Loop<
+      StaticTokenizer<1>,
+      ParameterCalculator<>,
+      Encoder<ZigZag<Token>, String<decltype("bitwidth"_tstr)>>,
+      Combiner<Token, LCTL_UNALIGNED>
+    >,
+    Combiner<
+      Concat<
+        String<decltype("bitwidth"_tstr)>,
+        String<decltype("sum"_tstr)>,
+        String<decltype("avg"_tstr)>,
+        Token
+      >, 
+      LCTL_ALIGNED
+    >
+  >,
+  inputDatatype_t
+>;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 8;
+    
+    string formatstring = "sumavgdynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    testcaseBlockAggregates < String < decltype("BlockAggregates"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, sumavgdynbp <PROCESSINGSTYLE, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringsigned = "sumavgdynbp<";
+    formatstringsigned.append(PROCESSINGSTYLESTRING);
+    formatstringsigned.append(", int");
+    formatstringsigned.append(std::to_string(BASEBITSIZE));
+    formatstringsigned.append("_t>");
+    
+    /* signed column with negative values: the averages are rounded down, not towards zero */
+    testcaseBlockAggregates < String < decltype("BlockAggregatesSigned"_tstr) >, SIGNEDLOWER, SIGNEDUPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, sumavgdynbp <PROCESSINGSTYLE, SIGNEDBASE> >::apply(
+            argv,
+            formatstringsigned);
+  }
+  return 0;
+}
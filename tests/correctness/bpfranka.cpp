@@ -0,0 +1,35 @@
+/*
+ * Compile with 
+ * g++ -O3 -msse4.2 -I/$TVL -DSSE -DCOMPRESSEDBASEBITSIZE=8 -DBASEBITSIZE=8 -DUPPER=31 -DBIT_WIDTH=5 -o bpfranka bpfranka.cpp
+ * bpfranka has 8 bit input values, thus COMPRESSEDBASEBITSIZE and BASEBITSIZE are 8
+ */
+#include "testcase.h"
+#include "../../columnformats/forbp/bpfranka.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 2;
+    /* blocks of one register, each lane gets 8 values, which hit a word border with each bitwidth */
+    const size_t blocksize = PROCESSINGSTYLE::vector_helper_t::size_bit::value;
+    
+    string formatstring = "bpfranka<";
+    formatstring.append(std::to_string(BIT_WIDTH));
+    formatstring.append(", ");
+    formatstring.append(std::to_string(blocksize));
+    formatstring.append(", ");
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(">");
+    
+    testcaseCorrectness < String < decltype("BPFranka"_tstr) >, 0, UPPER, blocksize * countInLog, false, bpfranka <BIT_WIDTH, blocksize, PROCESSINGSTYLE> >::apply(
+            argv,
+            formatstring);
+  }
+  return 0;
+}
@@ -0,0 +1,41 @@
+/*
+ * Compile with 
+ * g++ -O3 -pthread -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o compressparallel compressparallel.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 37;
+    
+    string formatstring = "dynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* 37 blocks and a data tail of three values on four threads: partitions of 10, 10 and 10 blocks, the last one with 7 blocks and the tail */
+    testcaseCompressParallel < String < decltype("CompressParallelDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 4 >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringfor = "dynforbp<";
+    formatstringfor.append(PROCESSINGSTYLESTRING);
+    formatstringfor.append(", 1, uint");
+    formatstringfor.append(std::to_string(BASEBITSIZE));
+    formatstringfor.append("_t>");
+    
+    /* more threads than blocks */
+    testcaseCompressParallel < String < decltype("CompressParallelDynForBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * 3, false, dynforbp <PROCESSINGSTYLE, 1, BASE>, 8 >::apply(
+            argv,
+            formatstringfor);
+  }
+  return 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o cursor cursor.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 8;
+    const size_t blocksize = PROCESSINGSTYLE::vector_helper_t::size_bit::value;
+    
+    string formatstring = "dynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* batches of three blocks, the last batch contains two blocks and a data tail of three values */
+    testcaseCursor < String < decltype("CursorDynBP"_tstr) >, 0, UPPER, blocksize * countInLog + 3, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 3 * blocksize >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringdelta = "deltabp<";
+    formatstringdelta.append(PROCESSINGSTYLESTRING);
+    formatstringdelta.append(", 1, uint");
+    formatstringdelta.append(std::to_string(BASEBITSIZE));
+    formatstringdelta.append("_t>");
+    
+    /* the reference of deltabp is carried from one batch to the next one */
+    testcaseCursor < String < decltype("CursorDeltaBP"_tstr) >, 0, UPPER, blocksize * countInLog, true, deltabp <PROCESSINGSTYLE, 1, BASE>, 3 * blocksize >::apply(
+            argv,
+            formatstringdelta);
+    
+    /* the data tail of deltabp is stored with the original values, the reference is added only to the whole blocks of the last batch */
+    testcaseCursor < String < decltype("CursorDeltaBPTail"_tstr) >, 0, UPPER, blocksize * countInLog + 3, true, deltabp <PROCESSINGSTYLE, 1, BASE>, 3 * blocksize >::apply(
+            argv,
+            formatstringdelta);
+    
+    string formatstringd = "delta<";
+    formatstringd.append(PROCESSINGSTYLESTRING);
+    formatstringd.append(", uint");
+    formatstringd.append(std::to_string(BASEBITSIZE));
+    formatstringd.append("_t>");
+    
+    testcaseCursor < String < decltype("CursorDelta"_tstr) >, 0, UPPER, blocksize * countInLog + 3, true, delta <PROCESSINGSTYLE, BASE>, 100 >::apply(
+            argv,
+            formatstringd);
+  }
+  return 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o decompressconsume decompressconsume.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 8;
+    
+    string formatstring = "dynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* one block and three blocks per batch, remaining blocks and data tail of three values */
+    testcaseDecompressConsume < String < decltype("DecompressConsumeDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 1 >::apply(
+            argv,
+            formatstring);
+    testcaseDecompressConsume < String < decltype("DecompressConsumeDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 3 >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringfor = "dynforbp<";
+    formatstringfor.append(PROCESSINGSTYLESTRING);
+    formatstringfor.append(", 1, uint");
+    formatstringfor.append(std::to_string(BASEBITSIZE));
+    formatstringfor.append("_t>");
+    
+    testcaseDecompressConsume < String < decltype("DecompressConsumeDynForBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, dynforbp <PROCESSINGSTYLE, 1, BASE>, 1 >::apply(
+            argv,
+            formatstringfor);
+    
+    string formatstringdelta = "deltabp<";
+    formatstringdelta.append(PROCESSINGSTYLESTRING);
+    formatstringdelta.append(", 1, uint");
+    formatstringdelta.append(std::to_string(BASEBITSIZE));
+    formatstringdelta.append("_t>");
+    
+    /* the reference of deltabp is carried from one block to the next one, the data tail is stored with the original values */
+    testcaseDecompressConsume < String < decltype("DecompressConsumeDeltaBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, true, deltabp <PROCESSINGSTYLE, 1, BASE>, 1 >::apply(
+            argv,
+            formatstringdelta);
+    testcaseDecompressConsume < String < decltype("DecompressConsumeDeltaBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, true, deltabp <PROCESSINGSTYLE, 1, BASE>, 3 >::apply(
+            argv,
+            formatstringdelta);
+  }
+  return 0;
+}
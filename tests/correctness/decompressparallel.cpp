@@ -0,0 +1,47 @@
+/*
+ * Compile with 
+ * g++ -O3 -pthread -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o decompressparallel decompressparallel.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 37;
+    const size_t blocksize = PROCESSINGSTYLE::vector_helper_t::size_bit::value;
+    
+    string formatstring = "dynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* partitions of three blocks, the last partition contains one block and a data tail of three values */
+    testcaseDecompressParallel < String < decltype("DecompressParallelDynBP"_tstr) >, 0, UPPER, blocksize * countInLog + 3, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 3 * blocksize, 4 >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringdelta = "deltabp<";
+    formatstringdelta.append(PROCESSINGSTYLESTRING);
+    formatstringdelta.append(", 1, uint");
+    formatstringdelta.append(std::to_string(BASEBITSIZE));
+    formatstringdelta.append("_t>");
+    
+    /* the reference of deltabp is stored in the directory */
+    testcaseDecompressParallel < String < decltype("DecompressParallelDeltaBP"_tstr) >, 0, UPPER, blocksize * countInLog, true, deltabp <PROCESSINGSTYLE, 1, BASE>, 3 * blocksize, 4 >::apply(
+            argv,
+            formatstringdelta);
+    
+    /* partitions of two cursor batches: the partitions are compressed batch by batch, the last batch contains a data tail of three values */
+    testcaseDecompressParallel < String < decltype("DecompressParallelDeltaBPTail"_tstr) >, 0, UPPER, blocksize * countInLog + 3, true, deltabp <PROCESSINGSTYLE, 1, BASE>, 2 * DecompressCursor < deltabp <PROCESSINGSTYLE, 1, BASE> >::batchsize, 4 >::apply(
+            argv,
+            formatstringdelta);
+  }
+  return 0;
+}
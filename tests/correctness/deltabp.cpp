@@ -0,0 +1,40 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o deltabp deltabp.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 2;
+    
+    string formatstring = "deltabp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* sorted data, UPPER is the maximal difference between two consecutive values */
+    testcaseCorrectness < String < decltype("DeltaBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, true, deltabp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    string formatstring4 = "delta4bp<";
+    formatstring4.append(PROCESSINGSTYLESTRING);
+    formatstring4.append(", 1, uint");
+    formatstring4.append(std::to_string(BASEBITSIZE));
+    formatstring4.append("_t>");
+    
+    testcaseCorrectness < String < decltype("Delta4BP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, true, delta4bp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstring4);
+  }
+  return 0;
+}
@@ -0,0 +1,52 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=31 -o dictionary dictionary.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 2;
+    
+    string formatstring = "dictionary<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    testcaseCorrectness < String < decltype("Dictionary"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dictionary <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringstat = "statdictionary<";
+    formatstringstat.append(PROCESSINGSTYLESTRING);
+    formatstringstat.append(", 2, uint");
+    formatstringstat.append(std::to_string(BASEBITSIZE));
+    formatstringstat.append("_t>");
+    
+    /* at most 4 distinct values fit into codes of 2 bits */
+    testcaseCorrectness < String < decltype("StatDictionary"_tstr) >, 0, 3, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, statdictionary <PROCESSINGSTYLE, 2, BASE> >::apply(
+            argv,
+            formatstringstat);
+    
+    /* 5 distinct values do not fit into codes of 2 bits: nothing is compressed */
+    BASE in[5] = {0, 1, 2, 3, 4};
+    uint8_t compressed[64];
+    const size_t size = Compress<statdictionary <PROCESSINGSTYLE, 2, BASE>>::apply((const uint8_t *) in, 5, compressed);
+    ofstream logfile;
+    string path = argv[1];
+    logfile.open(path + (size == 0 ? "/correct.log" : "/fail.log"), std::ios_base::app);
+    if (size != 0)
+      std::cout << "\t\033[31m*** FAIL (Distinct values exceed the code bitwidth) ***\033[0m\n";
+    logfile << "statdictionary with too many distinct values < " + formatstringstat + " >\n";
+    logfile.close();
+  }
+  return 0;
+}
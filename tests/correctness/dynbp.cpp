@@ -18,7 +18,7 @@ int main(int argc, char ** argv) {
     formatstring.append(std::to_string(BASEBITSIZE));
     formatstring.append("_t>");
     
-    testcaseCorrectness < String < decltype("DynamicBP"_tstr) >, 0, UPPER, sizeof(COMPRESSEDBASE) * 8 * countInLog * SCALE, false, dynbp <PROCESSINGSTYLE, SCALE, BASE> >::apply(
+    testcaseCorrectness < String < decltype("DynamicBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog * SCALE, false, dynbp <PROCESSINGSTYLE, SCALE, BASE> >::apply(
             argv,
             formatstring);
   }
@@ -0,0 +1,26 @@
+#include "testcase.h"
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+      
+    const size_t countInLog = 2;
+    
+    string formatstring = "dynbptracks<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", ");
+    
+    formatstring.append(std::to_string(BIT_WIDTH));
+    formatstring.append(", uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    testcaseTracks < String < decltype("DynamicBPTracks"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog * SCALE, false, dynbptracks <PROCESSINGSTYLE, SCALE, BASE> >::apply(
+            argv,
+            formatstring);
+  }
+  return 0;
+}
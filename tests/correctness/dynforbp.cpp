@@ -23,7 +23,12 @@ int main(int argc, char ** argv) {
     formatstring.append(std::to_string(BASEBITSIZE));
     formatstring.append("_t>");
     
-    testcaseCorrectness < String < decltype("Dynamic FOR Dynamic BP"_tstr) >, 0, UPPER, sizeof(COMPRESSEDBASE) * 8 * countInLog * SCALE, false, dynforbp< PROCESSINGSTYLE, SCALE, BASE> >::apply(
+    testcaseCorrectness < String < decltype("Dynamic FOR Dynamic BP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog * SCALE, false, dynforbp< PROCESSINGSTYLE, SCALE, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    /* minima of the blocks with the upper half of the bits, wider than the compressed datatype, if it is narrower than the input datatype */
+    testcaseCorrectness < String < decltype("Dynamic FOR Dynamic BP Large Minimum"_tstr) >, UPPER / 2 + 1, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog * SCALE, false, dynforbp< PROCESSINGSTYLE, SCALE, BASE> >::apply(
             argv,
             formatstring);
       }
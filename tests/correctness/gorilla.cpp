@@ -0,0 +1,45 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=31 -o gorilla gorilla.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+/* floating point datatype of the same width as BASE */
+using FLOATBASE = std::conditional<BASEBITSIZE == 64, double, float>::type;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 2;
+    
+    string formatstring = "gorilla<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* bit patterns of integers */
+    testcaseCorrectness < String < decltype("Gorilla"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, gorilla <PROCESSINGSTYLE, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringfloat = "gorilla<";
+    formatstringfloat.append(PROCESSINGSTYLESTRING);
+    formatstringfloat.append(BASEBITSIZE == 64 ? ", double>" : ", float>");
+    
+    /* floating point column with decimals (UPPER / 100), unsorted and sorted (slowly changing values share their leading and trailing zeros) */
+    testcaseCorrectness < String < decltype("GorillaFloat"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, gorilla <PROCESSINGSTYLE, FLOATBASE> >::apply(
+            argv,
+            formatstringfloat);
+    testcaseCorrectness < String < decltype("GorillaFloatSorted"_tstr) >, 0, 3, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, true, gorilla <PROCESSINGSTYLE, FLOATBASE> >::apply(
+            argv,
+            formatstringfloat);
+  }
+  return 0;
+}
@@ -0,0 +1,43 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o lookup lookup.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 8;
+    
+    string formatstring = "dynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* one index entry per block and one index entry per three blocks */
+    testcaseLookup < String < decltype("LookupDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 1 >::apply(
+            argv,
+            formatstring);
+    testcaseLookup < String < decltype("LookupDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 3 >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringfor = "dynforbp<";
+    formatstringfor.append(PROCESSINGSTYLESTRING);
+    formatstringfor.append(", 1, uint");
+    formatstringfor.append(std::to_string(BASEBITSIZE));
+    formatstringfor.append("_t>");
+    
+    testcaseLookup < String < decltype("LookupDynForBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dynforbp <PROCESSINGSTYLE, 1, BASE>, 1 >::apply(
+            argv,
+            formatstringfor);
+  }
+  return 0;
+}
@@ -0,0 +1,39 @@
+#include "testcase.h"
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+      
+    const size_t countInLog = 2;
+    
+    string formatstring = "pfor<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", ");
+    formatstring.append(std::to_string(SCALE));
+    formatstring.append(", ");
+    formatstring.append(std::to_string(PERCENT));
+    formatstring.append(", uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    testcaseCorrectness < String < decltype("PFOR"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog * SCALE, false, pfor <PROCESSINGSTYLE, SCALE, PERCENT, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    /* skewed data: small values and two full width outliers per block, which are encoded in the patch area */
+    using pfor_t = pfor <PROCESSINGSTYLE, SCALE, PERCENT, BASE>;
+    const size_t blocksize = pfor_t::staticTokensize;
+    std::vector<BASE> skewed(blocksize * 4 + 3);
+    for (size_t i = 0; i < skewed.size(); i++)
+      skewed[i] = (BASE) (i % 4);
+    for (size_t b = 0; b < skewed.size() / blocksize; b++) {
+      skewed[b * blocksize + 3] = (BASE) ~(BASE) b;
+      skewed[b * blocksize + blocksize - 5] = (BASE) ((BASE) ~(BASE) 0 >> 1);
+    }
+    testcaseGivenValues<pfor_t>::apply(argv, "Outliers", skewed, formatstring);
+  }
+  return 0;
+}
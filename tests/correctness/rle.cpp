@@ -0,0 +1,30 @@
+/*
+ * Compile with 
+ * g++ -O3 -mavx2 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=32 -DBASEBITSIZE=32 -DUPPER=31 -o rle rle.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    /* sorted data, such that there are runs longer than a vector register */
+    const size_t countInLog = 1000;
+    
+    string formatstring = "rle<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    testcaseCorrectness < String < decltype("RLE"_tstr) >, 0, UPPER, countInLog, true, rle <PROCESSINGSTYLE, BASE> >::apply(
+            argv,
+            formatstring);
+  }
+  return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DBIT_WIDTH=4 -DUPPER=15 -o select select.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 8;
+    
+    string formatstring = "statbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", " + std::to_string(BIT_WIDTH) + ", uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* data tail of three values */
+    testcaseSelect < String < decltype("SelectStatBPBetween"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, statbp <PROCESSINGSTYLE, BIT_WIDTH, BASE>, Between >::apply(
+            argv,
+            formatstring);
+    testcaseSelect < String < decltype("SelectStatBPLess"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, statbp <PROCESSINGSTYLE, BIT_WIDTH, BASE>, Less >::apply(
+            argv,
+            formatstring);
+    testcaseSelect < String < decltype("SelectStatBPGreaterEqual"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, statbp <PROCESSINGSTYLE, BIT_WIDTH, BASE>, GreaterEqual >::apply(
+            argv,
+            formatstring);
+    testcaseSelect < String < decltype("SelectStatBPEqual"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, statbp <PROCESSINGSTYLE, BIT_WIDTH, BASE>, Equal >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringdyn = "dynbp<";
+    formatstringdyn.append(PROCESSINGSTYLESTRING);
+    formatstringdyn.append(", 1, uint");
+    formatstringdyn.append(std::to_string(BASEBITSIZE));
+    formatstringdyn.append("_t>");
+    
+    testcaseSelect < String < decltype("SelectDynBPBetween"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, dynbp <PROCESSINGSTYLE, 1, BASE>, Between >::apply(
+            argv,
+            formatstringdyn);
+    
+    string formatstringdelta = "deltabp<";
+    formatstringdelta.append(PROCESSINGSTYLESTRING);
+    formatstringdelta.append(", 1, uint");
+    formatstringdelta.append(std::to_string(BASEBITSIZE));
+    formatstringdelta.append("_t>");
+    
+    /* block by block with the reference of the previous block */
+    testcaseSelect < String < decltype("SelectDeltaBPBetween"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, true, deltabp <PROCESSINGSTYLE, 1, BASE>, Between >::apply(
+            argv,
+            formatstringdelta);
+  }
+  return 0;
+}
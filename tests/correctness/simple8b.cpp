@@ -0,0 +1,44 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=32 -DUPPER=31 -o simple8b simple8b.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    /* more than the largest case (240 values), such that each selector can occur */
+    const size_t countInLog = 1000;
+    
+    string formatstring = "simple8b<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    testcaseCorrectness < String < decltype("Simple8b"_tstr) >, 0, UPPER, countInLog, false, simple8b <PROCESSINGSTYLE, BASE> >::apply(
+            argv,
+            formatstring);
+    
+#   if BASEBITSIZE == 64
+      /* a value >= 2^60 fits into no case of Simple-8b: nothing is compressed */
+      BASE in[3] = {1, (BASE) 1 << 60, 1};
+      uint8_t compressed[64];
+      const size_t size = Compress<simple8b <PROCESSINGSTYLE, BASE>>::apply((const uint8_t *) in, 3, compressed);
+      ofstream logfile;
+      string path = argv[1];
+      logfile.open(path + (size == 0 ? "/correct.log" : "/fail.log"), std::ios_base::app);
+      if (size != 0)
+        std::cout << "\t\033[31m*** FAIL (Value fits into no case) ***\033[0m\n";
+      logfile << "simple8b with a value of 2^60 < " + formatstring + " >\n";
+      logfile.close();
+#   endif
+  }
+  return 0;
+}
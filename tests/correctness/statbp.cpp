@@ -24,7 +24,7 @@ int main(int argc, char ** argv) {
     formatstring.append(std::to_string(BASEBITSIZE));
     formatstring.append("_t>");
     
-    testcaseCorrectness < String < decltype("StaticBP"_tstr) >, 0, UPPER, sizeof(COMPRESSEDBASE) * 8 * countInLog, false, statbp <PROCESSINGSTYLE, BIT_WIDTH, BASE> >::apply(
+    testcaseCorrectness < String < decltype("StaticBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, statbp <PROCESSINGSTYLE, BIT_WIDTH, BASE> >::apply(
             argv,
             formatstring);
   }
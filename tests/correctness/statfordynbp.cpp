@@ -25,7 +25,7 @@ int main(int argc, char ** argv) {
     formatstring.append(std::to_string(BASEBITSIZE));
     formatstring.append("_t>");
     
-    testcaseCorrectness < String < decltype("Static FOR Dynamic BP"_tstr) >, REF, UPPER, sizeof(COMPRESSEDBASE) * 8 * countInLog * SCALE, false, statfordynbp< PROCESSINGSTYLE, REF, SCALE, BASE> >::apply(
+    testcaseCorrectness < String < decltype("Static FOR Dynamic BP"_tstr) >, REF, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog * SCALE, false, statfordynbp< PROCESSINGSTYLE, REF, SCALE, BASE> >::apply(
             argv,
             formatstring);
       }
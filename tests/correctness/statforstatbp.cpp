@@ -25,7 +25,7 @@ int main(int argc, char ** argv) {
     formatstring.append(std::to_string(BASEBITSIZE));
     formatstring.append("_t>");
     
-    testcaseCorrectness < String < decltype("Static FOR Static BP"_tstr) >, REF_STATFORSTATBP, UPPER, sizeof(COMPRESSEDBASE) * 8 * countInLog, false, statforstatbp< PROCESSINGSTYLE, REF_STATFORSTATBP, BIT_WIDTH, BASE> >::apply(
+    testcaseCorrectness < String < decltype("Static FOR Static BP"_tstr) >, REF_STATFORSTATBP, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, statforstatbp< PROCESSINGSTYLE, REF_STATFORSTATBP, BIT_WIDTH, BASE> >::apply(
             argv,
             formatstring);
   }
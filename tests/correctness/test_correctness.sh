@@ -79,6 +79,486 @@ done;
 rm statforstatbp
 fi;
 
+# AVX2: vertical layout, input and compressed datatype are the same
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -mavx2 -I../../../TVLLib -DAVX2 -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -o statbp statbp.cpp
+    ./statbp $datestring "${datestring}/STATBP_AVX2_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -mavx2 -I../../../TVLLib -DAVX2 -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DREF_STATFORSTATBP=1 -o statforstatbp statforstatbp.cpp
+    ./statforstatbp $datestring "${datestring}/STATFORSTATBP_AVX2_UINT${basebitsize}_UINT${basebitsize}_REF1_BW${bitwidth}.err"
+    g++ -O3 -mavx2 -I../../../TVLLib -DAVX2 -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DSCALE=1 -o dynbp dynbp.cpp
+    ./dynbp $datestring "${datestring}/DYNBP_AVX2_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm statbp statforstatbp dynbp
+fi;
+
+# SSE: vertical layout, input and compressed datatype are the same
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -o statbp statbp.cpp
+    ./statbp $datestring "${datestring}/STATBP_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DREF_STATFORSTATBP=1 -o statforstatbp statforstatbp.cpp
+    ./statforstatbp $datestring "${datestring}/STATFORSTATBP_SSE_UINT${basebitsize}_UINT${basebitsize}_REF1_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DSCALE=1 -o dynbp dynbp.cpp
+    ./dynbp $datestring "${datestring}/DYNBP_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DREF=1 -DSCALE=1 -o statfordynbp statfordynbp.cpp
+    ./statfordynbp $datestring "${datestring}/STATFORDYNBP_SSE_UINT${basebitsize}_UINT${basebitsize}_REF1_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DSCALE=1 -o dynforbp dynforbp.cpp
+    ./dynforbp $datestring "${datestring}/DYNFORBP_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}_SCALE1.err"
+    # bpfranka has 8 bit input values
+    if [ $basebitsize -eq 8 ]
+    then
+      g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=8 -DBASEBITSIZE=8 -DUPPER=$upper -DBIT_WIDTH=$bitwidth -o bpfranka bpfranka.cpp
+      ./bpfranka $datestring "${datestring}/BPFRANKA_SSE_UINT8_UINT8_BW${bitwidth}.err"
+    fi
+  done;
+done;
+rm statbp statforstatbp dynbp statfordynbp dynforbp bpfranka
+fi;
+
+# AVX512: vertical layout, span values with VBMI2 concat-and-shift if available
+# only on hosts with AVX-512 (the binaries are executed), VBMI2 only if the host supports it
+if grep -q avx512bw /proc/cpuinfo; then
+if grep -q avx512vbmi2 /proc/cpuinfo
+then
+  avx512flags="-mavx512f -mavx512bw -mavx512vbmi2"
+else
+  avx512flags="-mavx512f -mavx512bw"
+fi
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 $avx512flags -I../../../TVLLib -DAVX512 -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -o statbp statbp.cpp
+    ./statbp $datestring "${datestring}/STATBP_AVX512_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 $avx512flags -I../../../TVLLib -DAVX512 -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DSCALE=1 -o dynbp dynbp.cpp
+    ./dynbp $datestring "${datestring}/DYNBP_AVX512_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm statbp dynbp
+fi;
+
+# two output tracks: descriptors (bitwidths) and data
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DSCALE=1 -o dynbptracks dynbptracks.cpp
+    ./dynbptracks $datestring "${datestring}/DYNBPTRACKS_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DSCALE=1 -o dynbptracks dynbptracks.cpp
+    ./dynbptracks $datestring "${datestring}/DYNBPTRACKS_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm dynbptracks
+fi;
+
+# Simple-8b: 64 bit words with 4 bit selector, values up to 60 bits
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -gt 60 ]
+    then
+      continue
+    fi
+    upper=$((2**$bitwidth-1))
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o simple8b simple8b.cpp
+    ./simple8b $datestring "${datestring}/SIMPLE8B_SCALAR_UINT64_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm simple8b
+fi;
+
+# VarintGB: groups of four values with a descriptor byte, scalar and PSHUFB decoder
+if [ 0 -eq 0 ]; then
+for bitwidth in $( seq 1 32 )
+do
+  upper=$((2**$bitwidth-1))
+  g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=8 -DBASEBITSIZE=32 -DUPPER=$upper -o varintgb varintgb.cpp
+  ./varintgb $datestring "${datestring}/VARINTGB_SCALAR_UINT8_UINT32_BW${bitwidth}.err"
+  g++ -O3 -mssse3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=8 -DBASEBITSIZE=32 -DUPPER=$upper -o varintgb varintgb.cpp
+  ./varintgb $datestring "${datestring}/VARINTGB_SSSE3_UINT8_UINT32_BW${bitwidth}.err"
+done;
+rm varintgb
+fi;
+
+# RLE: data dependent run tokenizer, SSE2 and AVX2 run detection
+if [ 0 -eq 0 ]; then
+for compressedbasebitsize in 8 16 32 64
+do
+  for basebitsize in 8 16 32 64
+  do
+    for bitwidth in 1 4 $basebitsize
+    do
+      if [ $bitwidth -lt 64 ]
+      then
+        upper=$((2**$bitwidth-1))
+      else
+        upper=18446744073709551615
+      fi
+      g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$compressedbasebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o rle rle.cpp
+      ./rle $datestring "${datestring}/RLE_SCALAR_UINT${compressedbasebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+      g++ -O3 -mavx2 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$compressedbasebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o rle rle.cpp
+      ./rle $datestring "${datestring}/RLE_AVX2_UINT${compressedbasebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    done;
+  done;
+done;
+rm rle
+fi;
+
+# Aggregation: sum, minimum, maximum and count of compressed columns
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 3 7 $basebitsize
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o aggregate aggregate.cpp
+    ./aggregate $datestring "${datestring}/AGGREGATE_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm aggregate
+fi;
+
+# dynforbp with a compressed datatype narrower than the input datatype: the minima of the blocks have the width of the input datatype
+if [ 0 -eq 0 ]; then
+for compressedbasebitsize in 8 16 32
+do
+  for basebitsize in 16 32 64
+  do
+    if [ $compressedbasebitsize -lt $basebitsize ]
+    then
+      for bitwidth in 1 7 $basebitsize
+      do
+        if [ $bitwidth -lt 64 ]
+        then
+          upper=$((2**$bitwidth-1))
+        else
+          upper=18446744073709551615
+        fi
+        g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$compressedbasebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -DSCALE=1 -o dynforbp dynforbp.cpp
+        ./dynforbp $datestring "${datestring}/DYNFORBP_SCALAR_UINT${compressedbasebitsize}_UINT${basebitsize}_BW${bitwidth}_SCALE1.err"
+        g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$compressedbasebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o aggregate aggregate.cpp
+        ./aggregate $datestring "${datestring}/AGGREGATE_SCALAR_UINT${compressedbasebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+      done;
+    fi
+  done;
+done;
+rm dynforbp aggregate
+fi;
+
+# Select: predicates on compressed columns, statbp on packed words, dynbp block by block
+if [ 0 -eq 0 ]; then
+for compressedbasebitsize in 8 16 32 64
+do
+  for basebitsize in 8 16 32 64
+  do
+    for bitwidth in 1 2 3 4 8 16 32 64
+    do
+      if [ $bitwidth -le $basebitsize ]
+      then
+        if [ $bitwidth -lt 64 ]
+        then
+          upper=$((2**$bitwidth-1))
+        else
+          upper=18446744073709551615
+        fi
+        g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$compressedbasebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DBIT_WIDTH=$bitwidth -o select select.cpp
+        ./select $datestring "${datestring}/SELECT_SCALAR_UINT${compressedbasebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+      fi
+    done;
+  done;
+done;
+rm select
+fi;
+
+# Decompression fused with a consumer: batches of blocks decompressed into the L1 cache
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 3 7 $basebitsize
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o decompressconsume decompressconsume.cpp
+    ./decompressconsume $datestring "${datestring}/DECOMPRESSCONSUME_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm decompressconsume
+fi;
+
+# Decompression cursor: resumable decompression batch by batch, reference of deltabp carried between the batches
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 3 7
+  do
+    upper=$((2**$bitwidth-1))
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o cursor cursor.cpp
+    ./cursor $datestring "${datestring}/CURSOR_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o cursor cursor.cpp
+    ./cursor $datestring "${datestring}/CURSOR_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm cursor
+fi;
+
+# Parallel compression: partitions at block borders, compressed layout identical to the sequential one
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 3 7 $basebitsize
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -pthread -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o compressparallel compressparallel.cpp
+    ./compressparallel $datestring "${datestring}/COMPRESSPARALLEL_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm compressparallel
+fi;
+
+# Parallel decompression: partition directory with byte offsets and references, deltabp partitions decompressed independently
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 3 7
+  do
+    upper=$((2**$bitwidth-1))
+    g++ -O3 -pthread -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o decompressparallel decompressparallel.cpp
+    ./decompressparallel $datestring "${datestring}/DECOMPRESSPARALLEL_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -pthread -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o decompressparallel decompressparallel.cpp
+    ./decompressparallel $datestring "${datestring}/DECOMPRESSPARALLEL_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm decompressparallel
+fi;
+
+# Zone maps: minimum and maximum per zone of blocks, block ranges of a range predicate
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 3 7 $basebitsize
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o zonemap zonemap.cpp
+    ./zonemap $datestring "${datestring}/ZONEMAP_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o zonemap zonemap.cpp
+    ./zonemap $datestring "${datestring}/ZONEMAP_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm zonemap
+fi;
+
+# Lookup: random access with a block index into dynbp and dynforbp
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 3 7 $basebitsize
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o lookup lookup.cpp
+    ./lookup $datestring "${datestring}/LOOKUP_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o lookup lookup.cpp
+    ./lookup $datestring "${datestring}/LOOKUP_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm lookup
+fi;
+
+# Delta with bit packed differences (D1 and D4): sorted data, SIMD prefix sum in the decompression
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o deltabp deltabp.cpp
+    ./deltabp $datestring "${datestring}/DELTABP_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+    g++ -O3 -msse4.2 -I../../../TVLLib -DSSE -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o deltabp deltabp.cpp
+    ./deltabp $datestring "${datestring}/DELTABP_SSE_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm deltabp
+fi;
+
+# ALP: decimals converted to integers per block, bit packed with statfordynbp
+if [ 0 -eq 0 ]; then
+for upper in 1 100 10000 1000000 100000000 10000000000
+do
+  g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=$upper -o alp alp.cpp
+  ./alp $datestring "${datestring}/ALP_SCALAR_UINT64_DOUBLE_UPPER${upper}.err"
+done;
+rm alp
+fi;
+
+# Gorilla: XOR with the previous value, bit stream without leading and trailing zeros (integer and float/double columns)
+if [ 0 -eq 0 ]; then
+for basebitsize in 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o gorilla gorilla.cpp
+    ./gorilla $datestring "${datestring}/GORILLA_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm gorilla
+fi;
+
+# ZigZag mapped formats: signed columns with negative values (zigzagdynbp, zigzagstatbp, zigzagdelta)
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o zigzagdynbp zigzagdynbp.cpp
+    ./zigzagdynbp $datestring "${datestring}/ZIGZAGDYNBP_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm zigzagdynbp
+fi;
+
+# Sum<Token> and Avg<Token> as block parameters: unsigned and signed columns, the averages are rounded down
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 7 $basebitsize
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o blockaggregates blockaggregates.cpp
+    ./blockaggregates $datestring "${datestring}/BLOCKAGGREGATES_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm blockaggregates
+fi;
+
+# Dictionary: sorted dictionary in the header, codes bit packed with dynbp
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in 1 2 4 8
+  do
+    upper=$((2**$bitwidth-1))
+    g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -o dictionary dictionary.cpp
+    ./dictionary $datestring "${datestring}/DICTIONARY_SCALAR_UINT${basebitsize}_UINT${basebitsize}_BW${bitwidth}.err"
+  done;
+done;
+rm dictionary
+fi;
+
+# PFOR: percentile bitwidth per block, exceptions in a patch area behind the block
+if [ 0 -eq 0 ]; then
+for basebitsize in 8 16 32 64
+do
+  for bitwidth in $( seq 1 $basebitsize )
+  do
+    if [ $bitwidth -lt 64 ]
+    then
+      upper=$((2**$bitwidth-1))
+    else
+      upper=18446744073709551615
+    fi
+    for percent in 50 90 100
+    do
+      g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=$basebitsize -DBASEBITSIZE=$basebitsize -DUPPER=$upper -DSCALE=1 -DPERCENT=$percent -o pfor pfor.cpp
+      ./pfor $datestring "${datestring}/PFOR_SCALAR_UINT${basebitsize}_UINT${basebitsize}_P${percent}_BW${bitwidth}.err"
+    done;
+  done;
+done;
+rm pfor
+fi;
+
+# Stream VByte: control track with descriptor bytes and data track
+if [ 0 -eq 0 ]; then
+for bitwidth in $( seq 1 32 )
+do
+  upper=$((2**$bitwidth-1))
+  g++ -O3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=8 -DBASEBITSIZE=32 -DUPPER=$upper -o streamvbyte streamvbyte.cpp
+  ./streamvbyte $datestring "${datestring}/STREAMVBYTE_SCALAR_UINT8_UINT32_BW${bitwidth}.err"
+  g++ -O3 -mssse3 -I../../../TVLLib -DSCALAR -DCOMPRESSEDBASEBITSIZE=8 -DBASEBITSIZE=32 -DUPPER=$upper -o streamvbyte streamvbyte.cpp
+  ./streamvbyte $datestring "${datestring}/STREAMVBYTE_SSSE3_UINT8_UINT32_BW${bitwidth}.err"
+done;
+rm streamvbyte
+fi;
+
 if [ 0 -eq 1 ]; then
 for compressedbasebitsize in 8 16 32 64
 do
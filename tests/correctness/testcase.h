@@ -19,11 +19,27 @@
 #include "../../Definitions.h"
 #include "../../conversion/columnformat/Compress.h"
 #include "../../conversion/columnformat/Decompress.h"
+#include "../../conversion/columnformat/CompressTracks.h"
+#include "../../conversion/columnformat/DecompressTracks.h"
+#include "../../conversion/columnformat/CompressDictionary.h"
+#include "../../conversion/columnformat/DecompressDictionary.h"
+#include "../../conversion/columnformat/CompressALP.h"
+#include "../../conversion/columnformat/DecompressALP.h"
+#include "../../conversion/columnformat/Lookup.h"
+#include "../../conversion/columnformat/ZoneMap.h"
+#include "../../conversion/columnformat/Select.h"
+#include "../../conversion/columnformat/Aggregate.h"
+#include "../../conversion/columnformat/DecompressConsume.h"
+#include "../../conversion/columnformat/DecompressCursor.h"
+#include "../../conversion/columnformat/CompressParallel.h"
+#include "../../conversion/columnformat/DecompressParallel.h"
 #include <header/preprocessor.h>
 #include <type_traits>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "../TestDefinitions.h"
 
@@ -65,13 +81,36 @@ struct dataGenerator{
     base_t * in = create_array < base_t > (countInLog_t, distr);
     /* if data has to be sorted, interpret each value except the first as the deifference to its predecessor: encode the values */
     if (isSorted_t) {
-      for (int i = 0; i < countInLog_t; i++)
+      for (size_t i = 0; i + 1 < countInLog_t; i++)
         in [i + 1] = in [i] + in [i + 1];
     }
     return in;
   }
 };
 
+/* floating point columns: decimals with two decimal places, i.e. prices */
+template <uint64_t lower_t, uint64_t upper_t, size_t countInLog_t, bool isSorted_t>
+struct dataGenerator<double, lower_t, upper_t, countInLog_t, isSorted_t>{
+  static double * create(){
+    uint64_t * integers = dataGenerator<uint64_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    double * in = (double *) integers;
+    for (size_t i = 0; i < countInLog_t; i++)
+      in[i] = (double) integers[i] / 100.0;
+    return in;
+  }
+};
+
+template <uint64_t lower_t, uint64_t upper_t, size_t countInLog_t, bool isSorted_t>
+struct dataGenerator<float, lower_t, upper_t, countInLog_t, isSorted_t>{
+  static float * create(){
+    uint32_t * integers = dataGenerator<uint32_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    float * in = (float *) integers;
+    for (size_t i = 0; i < countInLog_t; i++)
+      in[i] = (float) integers[i] / 100.0f;
+    return in;
+  }
+};
+
 template <size_t countInLog_t, typename base_t>
 struct testSizes{
   
@@ -114,9 +153,13 @@ struct testSizes{
         s
       );
       s << "Binary Input Values and Decompressed Values\n";
+      /* bit patterns, also for floating point values */
+      using bits_t = typename std::conditional<sizeof(base_t) == 8, uint64_t,
+                     typename std::conditional<sizeof(base_t) == 4, uint32_t,
+                     typename std::conditional<sizeof(base_t) == 2, uint16_t, uint8_t>::type>::type>::type;
       print_compare(
-        reinterpret_cast <const base_t * > (in),
-        reinterpret_cast <const base_t * > (decompressedMemoryRegion),
+        reinterpret_cast <const bits_t * > (in),
+        reinterpret_cast <const bits_t * > (decompressedMemoryRegion),
         countInLog_t,
         sizeof(base_t) * 8,
         s);
@@ -213,9 +256,10 @@ struct testcaseRuntimes {
     bool passed = testSizes<countInLog_t, base_t>::test(sizeDecompressedInBytes);
     
     
-    /* test, if all corresponding uncompressed and decompressed values are equal*/
-    for (int i = 0; i < countInLog_t && i < sizeDecompressedInBytes; i++) {
-      passed = passed && (reinterpret_cast < uint8_t * > (in)[i] == (reinterpret_cast < uint8_t * > (decompressedMemoryRegion))[i]);
+    /* test, if all corresponding uncompressed and decompressed values are equal,
+     * the bit patterns are compared, thus NaN values of floating point columns match, too */
+    for (size_t i = 0; i < countInLog_t && i * sizeof(base_t) < sizeDecompressedInBytes; i++) {
+      passed = passed && memcmp(in + i, decompressedMemoryRegion + i, sizeof(base_t)) == 0;
       /*if test failed, stop here and print differences red, break*/
       if (!passed) {
         std::cout << "\t\033[31m*** FAIL (Values) ***\033[0m\n";
@@ -263,11 +307,1040 @@ struct testcaseRuntimes {
       
       logfile.open(path + "/fail.log", std::ios_base::app);
     }
-    logfile << "testcaseCorrectness < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", false, " + formatstring + " >" << "\n";
+    logfile << "testcaseCorrectness < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << (isSorted_t ? ", true, " : ", false, ") + formatstring + " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+    free(decompressedMemoryRegion);
+  
+    return;
+  };
+};
+
+/* the test drivers and the log files name the testcase testcaseCorrectness */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t 
+>
+using testcaseCorrectness = testcaseRuntimes<name_t, lower_t, upper_t, countInLog_t, isSorted_t, format_t>;
+
+/**
+ * @brief Testcase for formats with a combiner with two output tracks (descriptors and data).
+ * Same as testcaseRuntimes, but with CompressTracks and DecompressTracks.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t 
+>
+struct testcaseTracks {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    /* memory regions to store the compressed descriptor and data tracks */
+    compressedbase_t * descriptorMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    /* memory region to store decompressed values */
+    base_t * decompressedMemoryRegion = (base_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+
+    /* data compression, sizes of the compressed tracks are stored in bytes */
+    std::array<size_t, 2> sizeCompressedInBytes = CompressTracks<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) descriptorMemoryRegion,
+      (uint8_t *) compressedMemoryRegion
+    );
+    
+    /* data decompression, the decompressor has to read exactly the compressed tracks */
+    std::array<size_t, 2> sizeReadInBytes = DecompressTracks<format_t>::apply(
+      (const uint8_t *) descriptorMemoryRegion,
+      (const uint8_t *) compressedMemoryRegion,
+      countInLog_t, 
+      (uint8_t *) decompressedMemoryRegion);
+     
+    std::cout << "  Descriptor track:\t" << sizeCompressedInBytes[0] << " Bytes\n";
+    testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes[1], countInLog_t * sizeof(base_t));
+    
+    bool passed = (sizeCompressedInBytes == sizeReadInBytes);
+    if (!passed)
+      std::cout << "\t\033[31m*** FAIL (Track Sizes) ***\033[0m\n";
+    
+    /* test, if all corresponding uncompressed and decompressed values are equal*/
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      passed = (in[i] == decompressedMemoryRegion[i]);
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Values) ***\033[0m\n";
+    }
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes[1], countInLog_t * sizeof(base_t), errorfile);
+      printIncorrectValues(
+          in, 
+          compressedMemoryRegion, 
+          sizeCompressedInBytes[1]/sizeof(compressedbase_t),
+          decompressedMemoryRegion, 
+          countInLog_t,
+          errorfile); 
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseTracks < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << (isSorted_t ? ", true, " : ", false, ") + formatstring + " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(descriptorMemoryRegion);
+    free(compressedMemoryRegion);
+    free(decompressedMemoryRegion);
+  
+    return;
+  };
+};
+
+/**
+ * @brief Testcase for a given input column, which the data generator can not create (i.e. skewed data with outliers):
+ * compresses and decompresses the column and compares the bit patterns of all values.
+ */
+template <typename format_t>
+struct testcaseGivenValues {
+  using base_t = typename format_t::base_t;
+
+  static void apply(char ** argv, const string & description, const std::vector<base_t> & in, string formatstring)
+  {
+    const size_t countInLog = in.size();
+    /* word aligned memory regions, the compressed region with space for full width exceptions */
+    std::vector<uint64_t> compressed((countInLog * sizeof(base_t) * 4 + 1024) / sizeof(uint64_t));
+    std::vector<uint64_t> decompressed((countInLog * sizeof(base_t) * 2 + 1024) / sizeof(uint64_t));
+    const size_t sizeCompressedInBytes = Compress<format_t>::apply((const uint8_t *) in.data(), countInLog, (uint8_t *) compressed.data());
+    const size_t sizeDecompressedInBytes = Decompress<format_t>::apply((const uint8_t *) compressed.data(), countInLog, (uint8_t *) decompressed.data());
+    std::cout << "  " << description << ":\t" << sizeCompressedInBytes << " Bytes compressed\n";
+    const bool passed = sizeDecompressedInBytes == countInLog * sizeof(base_t)
+      && memcmp(in.data(), decompressed.data(), countInLog * sizeof(base_t)) == 0;
+    if (!passed)
+      std::cout << "\t\033[31m*** FAIL (" << description << ") ***\033[0m\n";
+    ofstream logfile;
+    string path = argv[1];
+    logfile.open(path + (passed ? "/correct.log" : "/fail.log"), std::ios_base::app);
+    logfile << "testcaseGivenValues < " + formatstring + " > " + description + "\n";
+    logfile.close();
+  }
+};
+
+/**
+ * @brief Testcase for the random access with a block index (Lookup<format, blocksPerEntry_t>).
+ * The column is compressed with the index, each value is read with Lookup::get, 
+ * all values are read with Lookup::gather, and the compressed memory region is decompressed with Decompress.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t,
+  size_t blocksPerEntry_t
+>
+struct testcaseLookup {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+  using lookup_t = Lookup<format_t, blocksPerEntry_t>;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    base_t * decompressedMemoryRegion = (base_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    size_t * positions = (size_t * ) malloc(countInLog_t * sizeof(size_t));
+
+    /* data compression with the block index */
+    std::vector<size_t> index;
+    size_t sizeCompressedInBytes = lookup_t::compress(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion,
+      index
+    );
+    std::cout << "  Index entries:\t" << index.size() << "\n";
+    
+    /* single values in reverse order, such that no decompressed block can be reused */
+    bool passed = true;
+    for (size_t i = countInLog_t; passed && i-- > 0;) {
+      passed = (in[i] == lookup_t::get((const uint8_t *) compressedMemoryRegion, index, countInLog_t, i));
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Lookup at " << i << ") ***\033[0m\n";
+    }
+    
+    /* all values, the values at even positions first, then the values at odd positions */
+    const size_t even = (countInLog_t + 1) / 2;
+    for (size_t i = 0; i < countInLog_t; i++)
+      positions[i] = i < even ? 2 * i : 2 * (i - even) + 1;
+    lookup_t::gather((const uint8_t *) compressedMemoryRegion, index, countInLog_t, positions, countInLog_t, decompressedMemoryRegion);
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      passed = (in[positions[i]] == decompressedMemoryRegion[i]);
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Gather) ***\033[0m\n";
+    }
+    
+    /* the compressed memory region is a usual compressed column */
+    size_t sizeDecompressedInBytes = Decompress<format_t>::apply(
+      (const uint8_t *) compressedMemoryRegion,
+      countInLog_t, 
+      (uint8_t *) decompressedMemoryRegion);
+    testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes);
+    passed = passed && testSizes<countInLog_t, base_t>::test(sizeDecompressedInBytes);
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      passed = (in[i] == decompressedMemoryRegion[i]);
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Values) ***\033[0m\n";
+    }
+#   if LCTL_VERBOSETEST
+      if (passed) 
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes, errorfile);
+      printIncorrectValues(
+          in, 
+          compressedMemoryRegion, 
+          sizeCompressedInBytes/sizeof(compressedbase_t),
+          decompressedMemoryRegion, 
+          countInLog_t,
+          errorfile); 
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseLookup < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", false, " + formatstring + ", " << blocksPerEntry_t << " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+    free(decompressedMemoryRegion);
+    free(positions);
+  
+    return;
+  };
+};
+
+/**
+ * @brief Testcase for zone maps (ZoneMap<format, blocksPerZone_t>).
+ * The column is compressed with the zone map, the zones are compared with the minimum and maximum of the input values,
+ * and the block ranges of a range predicate are decompressed. All values satisfying the predicate have to be in the block ranges.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t,
+  size_t blocksPerZone_t
+>
+struct testcaseZoneMap {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+  using zonemap_t = ZoneMap<format_t, blocksPerZone_t>;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    base_t * decompressedMemoryRegion = (base_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+
+    /* data compression with the zone map */
+    std::vector<Zone<base_t>> zones;
+    size_t sizeCompressedInBytes = zonemap_t::compress(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion,
+      zones
+    );
+    std::cout << "  Zones:\t\t" << zones.size() << "\n";
+    
+    /* zones have to contain the minimum and maximum of their values */
+    bool passed = true;
+    size_t position = 0;
+    for (const Zone<base_t> & zone : zones) {
+      base_t minimum = in[position], maximum = in[position];
+      for (size_t i = position; i < position + zone.count; i++) {
+        minimum = in[i] < minimum ? in[i] : minimum;
+        maximum = in[i] > maximum ? in[i] : maximum;
+      }
+      passed = passed && (zone.minimum == minimum) && (zone.maximum == maximum);
+      position += zone.count;
+    }
+    passed = passed && (position == countInLog_t);
+    if (!passed)
+      std::cout << "\t\033[31m*** FAIL (Zones) ***\033[0m\n";
+    
+    /* predicate range in the upper half of the value range */
+    const base_t lower = (base_t) (lower_t + (upper_t - lower_t) / 2);
+    const base_t upper = (base_t) (lower + (upper_t - lower_t) / 8);
+    std::vector<BlockRange> ranges;
+    const size_t countCandidates = zonemap_t::candidates(zones, lower, upper, ranges);
+    std::cout << "  Candidates:\t\t" << countCandidates << " of " << countInLog_t << " Values\n";
+    std::vector<bool> covered(countInLog_t, false);
+    for (const BlockRange & range : ranges) {
+      Decompress<format_t>::apply(
+        (const uint8_t *) compressedMemoryRegion + range.offset,
+        range.count, 
+        (uint8_t *) decompressedMemoryRegion);
+      for (size_t i = 0; i < range.count; i++) {
+        passed = passed && (in[range.position + i] == decompressedMemoryRegion[i]);
+        covered[range.position + i] = true;
+      }
+    }
+    for (size_t i = 0; i < countInLog_t; i++)
+      passed = passed && (covered[i] || in[i] < lower || in[i] > upper);
+    if (!passed)
+      std::cout << "\t\033[31m*** FAIL (Block Ranges) ***\033[0m\n";
+#   if LCTL_VERBOSETEST
+      else
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseZoneMap < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", false, " + formatstring + ", " << blocksPerZone_t << " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+    free(decompressedMemoryRegion);
+  
+    return;
+  };
+};
+
+/**
+ * @brief Testcase for selections on compressed columns (Select<format, predicate_t>).
+ * The positions and the bitmap of the matching values are compared with the predicate evaluated on the input values.
+ * The constants are one third and two thirds of the value range.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t,
+  typename predicate_t
+>
+struct testcaseSelect {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    size_t * positions = (size_t * ) malloc(countInLog_t * sizeof(size_t));
+    uint64_t * bitmap = (uint64_t * ) malloc((countInLog_t + 63) / 64 * sizeof(uint64_t));
+
+    size_t sizeCompressedInBytes = Compress<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion
+    );
+    
+    const base_t constant1 = (base_t) (lower_t + (upper_t - lower_t) / 3);
+    const base_t constant2 = (base_t) (lower_t + (upper_t - lower_t) / 3 * 2);
+    const size_t countPositions = Select<format_t, predicate_t>::positions(
+      (const uint8_t *) compressedMemoryRegion, countInLog_t, positions, constant1, constant2);
+    const size_t countBitmap = Select<format_t, predicate_t>::bitmap(
+      (const uint8_t *) compressedMemoryRegion, countInLog_t, bitmap, constant1, constant2);
+    std::cout << "  Matching values:\t" << countPositions << " of " << countInLog_t << "\n";
+    
+    /* expected result: predicate on the input values */
+    base_t lower, upper;
+    const bool satisfiable = predicate_t::range(constant1, constant2, lower, upper);
+    size_t expected = 0;
+    bool passed = (countPositions == countBitmap);
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      const bool match = satisfiable && in[i] >= lower && in[i] <= upper;
+      passed = (((bitmap[i / 64] >> (i % 64)) & 1) == match);
+      if (match) {
+        passed = passed && expected < countPositions && positions[expected] == i;
+        expected++;
+      }
+    }
+    passed = passed && (expected == countPositions);
+    if (!passed)
+      std::cout << "\t\033[31m*** FAIL (Selection) ***\033[0m\n";
+#   if LCTL_VERBOSETEST
+      else
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, countInLog_t * sizeof(base_t), errorfile);
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseSelect < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", false, " + formatstring + " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+    free(positions);
+    free(bitmap);
+  
+    return;
+  };
+};
+
+/**
+ * @brief Testcase for aggregations on compressed columns (Aggregate<format, op_t>).
+ * Sum, minimum, maximum and count of the compressed column are compared with the aggregations of the input values.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t
+>
+struct testcaseAggregate {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+
+    size_t sizeCompressedInBytes = Compress<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion
+    );
+    
+    /* expected results: aggregations of the input values */
+    uint64_t sum = 0;
+    base_t minimum = in[0], maximum = in[0];
+    for (size_t i = 0; i < countInLog_t; i++) {
+      sum += (uint64_t) in[i];
+      minimum = in[i] < minimum ? in[i] : minimum;
+      maximum = in[i] > maximum ? in[i] : maximum;
+    }
+    const uint8_t * compressed8 = (const uint8_t *) compressedMemoryRegion;
+    bool passed = true;
+    if (Aggregate<format_t, Sum<Token>>::apply(compressed8, countInLog_t) != sum) {
+      std::cout << "\t\033[31m*** FAIL (Sum) ***\033[0m\n";
+      passed = false;
+    }
+    if (Aggregate<format_t, Min<Token>>::apply(compressed8, countInLog_t) != minimum) {
+      std::cout << "\t\033[31m*** FAIL (Min) ***\033[0m\n";
+      passed = false;
+    }
+    if (Aggregate<format_t, Max<Token>>::apply(compressed8, countInLog_t) != maximum) {
+      std::cout << "\t\033[31m*** FAIL (Max) ***\033[0m\n";
+      passed = false;
+    }
+    if (Aggregate<format_t, Count<Token>>::apply(compressed8, countInLog_t) != countInLog_t) {
+      std::cout << "\t\033[31m*** FAIL (Count) ***\033[0m\n";
+      passed = false;
+    }
+#   if LCTL_VERBOSETEST
+      if (passed)
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, countInLog_t * sizeof(base_t), errorfile);
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseAggregate < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", false, " + formatstring + " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+  
+    return;
+  };
+};
+
+/**
+ * @brief Testcase for the block aggregations Sum<Token> and Avg<Token> as block parameters (SumIR, AvgIR).
+ * The format stores the bitwidth, the sum and the average of each block in one word each, followed by the packed values
+ * (scalar processing style, Concat<bitwidth, sum, avg, Token>). The stored sums and averages are compared with the
+ * sums modulo the width of base_t and the averages rounded down of the input blocks, the decompressed column with the input.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t
+>
+struct testcaseBlockAggregates {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+  static constexpr size_t blocksize = format_t::staticTokensize;
+  static constexpr size_t wordbits = sizeof(compressedbase_t) * 8;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    base_t * decompressedMemoryRegion = (base_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+
+    size_t sizeCompressedInBytes = Compress<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion
+    );
+    
+    /* stored sums and averages of the blocks */
+    const compressedbase_t * block = compressedMemoryRegion;
+    bool passed = true;
+    for (size_t b = 0; passed && b < countInLog_t / blocksize; b++) {
+      /* expected sum and average, the exact sum of the block in 128 bits and its quotient rounded down */
+      __int128 sum = 0;
+      for (size_t i = 0; i < blocksize; i++)
+        sum += (__int128) in[b * blocksize + i];
+      __int128 average = sum / (__int128) blocksize;
+      if (sum < 0 && sum % (__int128) blocksize != 0)
+        average--;
+      const size_t bitwidth = (size_t) block[0];
+      if ((base_t) block[1] != (base_t) sum) {
+        std::cout << "\t\033[31m*** FAIL (Block Sums) ***\033[0m\n";
+        passed = false;
+      }
+      if ((base_t) block[2] != (base_t) average) {
+        std::cout << "\t\033[31m*** FAIL (Block Averages) ***\033[0m\n";
+        passed = false;
+      }
+      block += 3 + (blocksize * bitwidth + wordbits - 1) / wordbits;
+    }
+    
+    size_t sizeDecompressedInBytes = Decompress<format_t>::apply(
+      (const uint8_t *) compressedMemoryRegion,
+      countInLog_t, 
+      (uint8_t *) decompressedMemoryRegion);
+    testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes);
+    passed = passed && testSizes<countInLog_t, base_t>::test(sizeDecompressedInBytes);
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      passed = (in[i] == decompressedMemoryRegion[i]);
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Values) ***\033[0m\n";
+    }
+#   if LCTL_VERBOSETEST
+      if (passed)
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes, errorfile);
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseBlockAggregates < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", false, " + formatstring + " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+    free(decompressedMemoryRegion);
+  
+    return;
+  };
+};
+
+/**
+ * @brief consumer for testcaseDecompressConsume: copies the batches to the output (projection)
+ * and checks, that the batches arrive in order.
+ */
+template <typename base_t>
+struct testConsumer {
+  base_t * out;
+  size_t nextPosition;
+  size_t batches;
+  bool inOrder;
+  void operator()(const base_t * values, const size_t count, const size_t position) {
+    inOrder = inOrder && position == nextPosition;
+    for (size_t j = 0; j < count; j++)
+      out[position + j] = values[j];
+    nextPosition = position + count;
+    batches++;
+  }
+};
+
+/**
+ * @brief Testcase for decompression fused with a consumer (DecompressConsume<format, blocksPerBatch>).
+ * The consumer copies the values, the copied column is compared with the input.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t,
+  const size_t blocksPerBatch_t
+>
+struct testcaseDecompressConsume {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+  using consume_t = DecompressConsume<format_t, blocksPerBatch_t>;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    base_t * decompressedMemoryRegion = (base_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+
+    size_t sizeCompressedInBytes = Compress<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion
+    );
+    
+    testConsumer<base_t> consumer{decompressedMemoryRegion, 0, 0, true};
+    size_t sizeDecompressedInBytes = consume_t::apply(
+      (const uint8_t *) compressedMemoryRegion,
+      countInLog_t,
+      consumer) * sizeof(base_t);
+    std::cout << "  Batches:\t\t" << consumer.batches << "\n";
+    testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes);
+    bool passed = testSizes<countInLog_t, base_t>::test(sizeDecompressedInBytes);
+    if (!consumer.inOrder || consumer.nextPosition != countInLog_t 
+        || consumer.batches != (countInLog_t + consume_t::batchsize_t - 1) / consume_t::batchsize_t) {
+      std::cout << "\t\033[31m*** FAIL (Batches) ***\033[0m\n";
+      passed = false;
+    }
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      passed = (in[i] == decompressedMemoryRegion[i]);
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Values) ***\033[0m\n";
+    }
+#   if LCTL_VERBOSETEST
+      if (passed)
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes, errorfile);
+      printIncorrectValues(
+          in, 
+          compressedMemoryRegion, 
+          sizeCompressedInBytes/sizeof(compressedbase_t),
+          decompressedMemoryRegion, 
+          countInLog_t,
+          errorfile);
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseDecompressConsume < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", false, " + formatstring + ", " << blocksPerBatch_t << " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+    free(decompressedMemoryRegion);
+  
+    return;
+  };
+};
+
+/**
+ * @brief Testcase for the decompression cursor (DecompressCursor<format, batchsize>).
+ * The batches are copied from the caller-owned buffer to the output, the copied column is compared with the input.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t,
+  const size_t batchsize_t
+>
+struct testcaseCursor {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+  using cursor_t = DecompressCursor<format_t, batchsize_t>;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    base_t * decompressedMemoryRegion = (base_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+
+    size_t sizeCompressedInBytes = Compress<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion
+    );
+    
+    cursor_t cursor((const uint8_t *) compressedMemoryRegion, countInLog_t);
+    base_t buffer[cursor_t::batchsize];
+    size_t batches = 0;
+    size_t count;
+    while ((count = cursor.next(buffer)) > 0) {
+      for (size_t j = 0; j < count; j++)
+        decompressedMemoryRegion[cursor.position - count + j] = buffer[j];
+      batches++;
+    }
+    size_t sizeDecompressedInBytes = cursor.position * sizeof(base_t);
+    std::cout << "  Batches:\t\t" << batches << "\n";
+    testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes);
+    bool passed = testSizes<countInLog_t, base_t>::test(sizeDecompressedInBytes);
+    if (!cursor.done() || batches != (countInLog_t + cursor_t::batchsize - 1) / cursor_t::batchsize) {
+      std::cout << "\t\033[31m*** FAIL (Batches) ***\033[0m\n";
+      passed = false;
+    }
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      passed = (in[i] == decompressedMemoryRegion[i]);
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Values) ***\033[0m\n";
+    }
+#   if LCTL_VERBOSETEST
+      if (passed)
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes, errorfile);
+      printIncorrectValues(
+          in, 
+          compressedMemoryRegion, 
+          sizeCompressedInBytes/sizeof(compressedbase_t),
+          decompressedMemoryRegion, 
+          countInLog_t,
+          errorfile);
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseCursor < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", " << isSorted_t << ", " + formatstring + ", " << batchsize_t << " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+    free(decompressedMemoryRegion);
+  
+    return;
+  };
+};
+
+/**
+ * @brief Testcase for the multi-threaded compression (CompressParallel<format>).
+ * The compressed memory region has to be the same as with Compress<format>, the decompressed column is compared with the input.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t,
+  const size_t countThreads_t
+>
+struct testcaseCompressParallel {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    compressedbase_t * compressedMemoryRegionSequential = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    /* scratch region with a worst-case bound of two uncompressed values per value */
+    uint8_t * scratchMemoryRegion = (uint8_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    base_t * decompressedMemoryRegion = (base_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+
+    size_t sizeCompressedInBytes = CompressParallel<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion,
+      scratchMemoryRegion,
+      countInLog_t * sizeof(base_t) * 2,
+      countThreads_t
+    );
+    size_t sizeCompressedSequentialInBytes = Compress<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegionSequential
+    );
+    size_t sizeDecompressedInBytes = Decompress<format_t>::apply(
+      (const uint8_t *) compressedMemoryRegion,
+      countInLog_t,
+      (uint8_t *) decompressedMemoryRegion);
+    testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes);
+    bool passed = testSizes<countInLog_t, base_t>::test(sizeDecompressedInBytes);
+    if (sizeCompressedInBytes != sizeCompressedSequentialInBytes 
+        || memcmp(compressedMemoryRegion, compressedMemoryRegionSequential, sizeCompressedInBytes) != 0) {
+      std::cout << "\t\033[31m*** FAIL (Compressed Layout) ***\033[0m\n";
+      passed = false;
+    }
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      passed = (in[i] == decompressedMemoryRegion[i]);
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Values) ***\033[0m\n";
+    }
+#   if LCTL_VERBOSETEST
+      if (passed)
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes, errorfile);
+      printIncorrectValues(
+          in, 
+          compressedMemoryRegion, 
+          sizeCompressedInBytes/sizeof(compressedbase_t),
+          decompressedMemoryRegion, 
+          countInLog_t,
+          errorfile);
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseCompressParallel < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", " << isSorted_t << ", " + formatstring + ", " << countThreads_t << " >" << "\n";
+    logfile.close();
+      
+    free(in);
+    free(compressedMemoryRegion);
+    free(compressedMemoryRegionSequential);
+    free(scratchMemoryRegion);
+    free(decompressedMemoryRegion);
+  
+    return;
+  };
+};
+
+/**
+ * @brief Testcase for the parallel decompression with a partition directory (DecompressParallel<format, partitionsize>).
+ * The compressed memory region has to be the same as with Compress<format>, the decompressed column is compared with the input.
+ */
+template <
+  typename name_t,
+  const uint64_t lower_t,
+  const uint64_t upper_t,
+  const size_t countInLog_t,
+  const bool isSorted_t,
+  typename format_t,
+  const size_t partitionsize_t,
+  const size_t countThreads_t
+>
+struct testcaseDecompressParallel {
+  using base_t = typename format_t::base_t;
+  using compressedbase_t = typename format_t::compressedbase_t;
+  using parallel_t = DecompressParallel<format_t, partitionsize_t>;
+
+  static void apply(char ** argv, string formatstring )
+  { 
+    testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print();
+    
+    base_t * in = dataGenerator<base_t, lower_t, upper_t, countInLog_t, isSorted_t>::create();
+    
+    compressedbase_t * compressedMemoryRegion = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    compressedbase_t * compressedMemoryRegionSequential = (compressedbase_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+    base_t * decompressedMemoryRegion = (base_t * ) malloc(countInLog_t * sizeof(base_t) * 2);
+
+    std::vector<Partition<base_t>> directory;
+    size_t sizeCompressedInBytes = parallel_t::compress(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegion,
+      directory
+    );
+    size_t sizeCompressedSequentialInBytes = Compress<format_t>::apply(
+      (const uint8_t *) in,
+      countInLog_t,
+      (uint8_t *) compressedMemoryRegionSequential
+    );
+    size_t sizeDecompressedInBytes = parallel_t::apply(
+      (const uint8_t *) compressedMemoryRegion,
+      directory,
+      countInLog_t,
+      (uint8_t *) decompressedMemoryRegion,
+      countThreads_t);
+    std::cout << "  Partitions:\t\t" << directory.size() << "\n";
+    testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes);
+    bool passed = testSizes<countInLog_t, base_t>::test(sizeDecompressedInBytes);
+    if (sizeCompressedInBytes != sizeCompressedSequentialInBytes 
+        || memcmp(compressedMemoryRegion, compressedMemoryRegionSequential, sizeCompressedInBytes) != 0) {
+      std::cout << "\t\033[31m*** FAIL (Compressed Layout) ***\033[0m\n";
+      passed = false;
+    }
+    for (size_t i = 0; passed && i < countInLog_t; i++) {
+      passed = (in[i] == decompressedMemoryRegion[i]);
+      if (!passed)
+        std::cout << "\t\033[31m*** FAIL (Values) ***\033[0m\n";
+    }
+#   if LCTL_VERBOSETEST
+      if (passed)
+        std::cout << "\t\033[32m*** MATCH (Values) ***\033[0m\n";
+#   endif
+
+    const char * n = name_t::GetString();
+    /* Write Logfile */
+    ofstream logfile;
+    string path = argv[1];
+    if (passed){
+      logfile.open(path + "/correct.log", std::ios_base::app);
+    } else {
+      ofstream errorfile;
+      std::cout << "ERRORFILE " << argv[2] << "\n";
+      errorfile.open(argv[2], std::ios_base::app);
+      testInfo<base_t, compressedbase_t, upper_t, countInLog_t, name_t>::print(errorfile);
+      testSizes<countInLog_t, base_t>::print(sizeCompressedInBytes, sizeDecompressedInBytes, errorfile);
+      printIncorrectValues(
+          in, 
+          compressedMemoryRegion, 
+          sizeCompressedInBytes/sizeof(compressedbase_t),
+          decompressedMemoryRegion, 
+          countInLog_t,
+          errorfile);
+      errorfile.close();
+      
+      logfile.open(path + "/fail.log", std::ios_base::app);
+    }
+    logfile << "testcaseDecompressParallel < String < decltype(\"" << n << "\"_tstr) >, " << lower_t << ", " << upper_t << ", " << countInLog_t << ", " << isSorted_t << ", " + formatstring + ", " << partitionsize_t << ", " << countThreads_t << " >" << "\n";
     logfile.close();
       
     free(in);
     free(compressedMemoryRegion);
+    free(compressedMemoryRegionSequential);
     free(decompressedMemoryRegion);
   
     return;
@@ -0,0 +1,26 @@
+/*
+ * Compile with 
+ * g++ -O3 -mssse3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=8 -DBASEBITSIZE=32 -DUPPER=31 -o varintgb varintgb.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    /* several groups with the SIMD decoder, the last groups and a tail of three values are decoded scalar */
+    const size_t countInLog = 103;
+    
+    string formatstring = "varintgb";
+    
+    testcaseCorrectness < String < decltype("VarintGB"_tstr) >, 0, UPPER, countInLog, false, varintgb >::apply(
+            argv,
+            formatstring);
+  }
+  return 0;
+}
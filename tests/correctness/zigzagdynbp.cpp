@@ -0,0 +1,80 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=32 -DBASEBITSIZE=32 -DUPPER=4294967295 -o zigzagdynbp zigzagdynbp.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+/* signed input datatype of the same width as BASE */
+using SIGNEDBASE = std::make_signed<BASE>::type;
+
+/* number of used bits of UPPER */
+constexpr size_t usedBitsOf(const uint64_t value) {
+  return value == 0 ? 0 : 1 + usedBitsOf(value >> 1);
+}
+
+/* signed values in [-2^(bitwidth-1), 2^(bitwidth-1)), bitwidth is the number of bits of UPPER, as uint64_t template arguments */
+constexpr uint64_t SIGNEDLOWER = (uint64_t) (- (int64_t) (UPPER / 2) - 1);
+constexpr uint64_t SIGNEDUPPER = UPPER / 2;
+/* for zigzagdelta: the differences of values in [-UPPER/4, UPPER/4] do not overflow */
+constexpr uint64_t DELTALOWER = (uint64_t) (- (int64_t) (UPPER / 4));
+constexpr uint64_t DELTAUPPER = UPPER / 4;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 2;
+    
+    string formatstring = "zigzagdynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* values with the highest bit set are negative values in two's complement */
+    testcaseCorrectness < String < decltype("ZigZagDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, zigzagdynbp <PROCESSINGSTYLE, 1, BASE> >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringsigned = "zigzagdynbp<";
+    formatstringsigned.append(PROCESSINGSTYLESTRING);
+    formatstringsigned.append(", 1, int");
+    formatstringsigned.append(std::to_string(BASEBITSIZE));
+    formatstringsigned.append("_t>");
+    
+    /* signed column with negative values */
+    testcaseCorrectness < String < decltype("ZigZagDynBPSigned"_tstr) >, SIGNEDLOWER, SIGNEDUPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, zigzagdynbp <PROCESSINGSTYLE, 1, SIGNEDBASE> >::apply(
+            argv,
+            formatstringsigned);
+    
+    string formatstringstat = "zigzagstatbp<";
+    formatstringstat.append(PROCESSINGSTYLESTRING);
+    formatstringstat.append(", ");
+    formatstringstat.append(std::to_string(usedBitsOf(UPPER)));
+    formatstringstat.append(", int");
+    formatstringstat.append(std::to_string(BASEBITSIZE));
+    formatstringstat.append("_t>");
+    
+    /* the ZigZag mapped values of [-2^(bitwidth-1), 2^(bitwidth-1)) fit into bitwidth bits */
+    testcaseCorrectness < String < decltype("ZigZagStatBPSigned"_tstr) >, SIGNEDLOWER, SIGNEDUPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, zigzagstatbp <PROCESSINGSTYLE, usedBitsOf(UPPER), SIGNEDBASE> >::apply(
+            argv,
+            formatstringstat);
+    
+    string formatstringdelta = "zigzagdelta<";
+    formatstringdelta.append(PROCESSINGSTYLESTRING);
+    formatstringdelta.append(", int");
+    formatstringdelta.append(std::to_string(BASEBITSIZE));
+    formatstringdelta.append("_t>");
+    
+    /* unsorted signed column: positive and negative differences */
+    testcaseCorrectness < String < decltype("ZigZagDeltaSigned"_tstr) >, DELTALOWER, DELTAUPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog + 3, false, zigzagdelta <PROCESSINGSTYLE, SIGNEDBASE> >::apply(
+            argv,
+            formatstringdelta);
+  }
+  return 0;
+}
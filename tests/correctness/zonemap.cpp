@@ -0,0 +1,43 @@
+/*
+ * Compile with 
+ * g++ -O3 -I/$TVL -DSCALAR -DCOMPRESSEDBASEBITSIZE=64 -DBASEBITSIZE=64 -DUPPER=255 -o zonemap zonemap.cpp
+ */
+#include "testcase.h"
+
+using namespace std;
+using namespace LCTL;
+
+int main(int argc, char ** argv) {
+  if (argc <= 1) {
+    cout << "No log file name entered. Exiting...";
+    return -1;
+  } else {
+    
+    const size_t countInLog = 8;
+    
+    string formatstring = "dynbp<";
+    formatstring.append(PROCESSINGSTYLESTRING);
+    formatstring.append(", 1, uint");
+    formatstring.append(std::to_string(BASEBITSIZE));
+    formatstring.append("_t>");
+    
+    /* one zone per block and one zone per three blocks */
+    testcaseZoneMap < String < decltype("ZoneMapDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 1 >::apply(
+            argv,
+            formatstring);
+    testcaseZoneMap < String < decltype("ZoneMapDynBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dynbp <PROCESSINGSTYLE, 1, BASE>, 3 >::apply(
+            argv,
+            formatstring);
+    
+    string formatstringfor = "dynforbp<";
+    formatstringfor.append(PROCESSINGSTYLESTRING);
+    formatstringfor.append(", 1, uint");
+    formatstringfor.append(std::to_string(BASEBITSIZE));
+    formatstringfor.append("_t>");
+    
+    testcaseZoneMap < String < decltype("ZoneMapDynForBP"_tstr) >, 0, UPPER, PROCESSINGSTYLE::vector_helper_t::size_bit::value * countInLog, false, dynforbp <PROCESSINGSTYLE, 1, BASE>, 1 >::apply(
+            argv,
+            formatstringfor);
+  }
+  return 0;
+}
@@ -16,10 +16,16 @@
 #include "../../codegeneration/RightShift.h"
 #include "../../codegeneration/Increment.h"
 #include "../../codegeneration/Write.h"
+#include "../../codegeneration/WriteVertical.h"
 #include "./ParameterGenerator.h"
 #include "./RolledLoopGenerator.h"
 #include "./EncoderGenerator.h"
 #include "./UnrolledLoop_Tokensize1_WOEncodedParameters_OuterConcatCombiner_Generator.h"
+#include "./UnrolledLoop_Tokensize1_WOEncodedParameters_TracksCombiner_Generator.h"
+#include "./UnrolledLoop_Tokensize1_WOEncodedParameters_ExceptionsCombiner_Generator.h"
+#include "./RolledLoop_MultipleConcatCombiner_Generator.h"
+#include "./RolledLoop_MeaningfulBitsCombiner_Generator.h"
+#include "./UnrolledLoop_Tokensize1_WOEncodedParameters_DeltaEncoder_Generator.h"
 #include <header/preprocessor.h>
 
 namespace LCTL {
@@ -177,6 +183,88 @@ namespace LCTL {
       );           
       return (uint8_t *) inBase;
     }
+
+    /**
+     * @brief compression for formats with a combiner with two output tracks (Tracks<...>).
+     * Descriptors (parameters) are written to descriptor8, data to out8.
+     * 
+     * @param in8         uncompressed input data as uint8_t
+     * @param countInLog  number of logical input values
+     * @param out8        memory region for the compressed data track as uint8_t
+     * @param descriptor8 memory region for the compressed descriptor track as uint8_t
+     * 
+     * @return            current pointer in the compressed data track
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint8_t * compress(
+            const uint8_t * & in8, 
+            const size_t countInLog, 
+            uint8_t * & out8,
+            uint8_t * & descriptor8)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, ColumnFormatIR<loop_t>, base_t, tokensize_t, 0, parametername_t...>::compress(tracks)\n";
+#     endif
+      const base_t * & inBase = reinterpret_cast<const base_t * & >(in8);
+      compressedbase_t * & outBase = reinterpret_cast<compressedbase_t * & >(out8);
+      DescriptorTrack<compressedbase_t> descriptorTrack{reinterpret_cast<compressedbase_t *>(descriptor8)};
+      Generator<
+        processingStyle_t, 
+        loop_t, 
+        base_t,
+        tokensize_t,
+        0,
+        parametername_t...
+      >::compress(
+        inBase, 
+        countInLog, 
+        outBase,
+        /* the descriptor track is always the last runtime parameter */
+        std::make_tuple(&descriptorTrack)
+      );
+      descriptor8 = (uint8_t *) descriptorTrack.base;
+      return (uint8_t *) outBase;
+    }
+
+    /**
+     * @brief decompression for formats with a combiner with two output tracks (Tracks<...>).
+     * 
+     * @param in8         compressed data track as uint8_t
+     * @param countInLog  number of logical input values
+     * @param out8        memory region for decompressed output data as uint8_t
+     * @param descriptor8 compressed descriptor track as uint8_t
+     * 
+     * @return            current pointer in the compressed data track
+     */
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint8_t * decompress(
+            const uint8_t * & in8, 
+            const size_t countInLog, 
+            uint8_t * & out8,
+            const uint8_t * & descriptor8)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, ColumnFormatIR<loop_t>, base_t, tokensize_t, 0, parametername_t...>::decompress(tracks)\n";
+#     endif
+      const compressedbase_t * & inBase = reinterpret_cast<const compressedbase_t * & >(in8);
+      base_t * & outBase = reinterpret_cast<base_t * & >(out8);
+      DescriptorTrack<const compressedbase_t> descriptorTrack{reinterpret_cast<const compressedbase_t *>(descriptor8)};
+      Generator<
+        processingStyle_t, 
+        loop_t, 
+        base_t,
+        tokensize_t,
+        0,
+        parametername_t...
+      >::decompress(
+        inBase, 
+        countInLog, 
+        outBase,
+        std::make_tuple(&descriptorTrack)
+      );
+      descriptor8 = (const uint8_t *) descriptorTrack.base;
+      return (uint8_t *) inBase;
+    }
   };
   
   /*
@@ -476,8 +564,8 @@ namespace LCTL {
         ((bitwidthparameter_t + bitposition) >= sizeof(compressedbase_t)*8), 
         /* datatype of inBase */
         compressedbase_t,
-        /* increase by ... values */
-        (bitwidthparameter_t + bitposition)  / (sizeof(compressedbase_t)*8)
+        /* increase by ... values (one compressed word per lane in SIMD cases) */
+        (bitwidthparameter_t + bitposition)  / (sizeof(compressedbase_t)*8) * LaneCount<processingStyle_t>::value
       >::apply(inBase);
       
       Generator<
@@ -658,7 +746,11 @@ namespace LCTL {
           std::cout << "Generator< processingStyle_t, UnrolledLoopIR<tokensizeOuterLoop_t, KnownTokenizerIR<1,EncoderIR<  logicalencoding_t, Value<size_t,bitwidth_t>, Combiner<Token, LCTL_UNALIGNED> >>, Combiner<Token, LCTL_UNALIGNED>,Combiner<Concat<std::tuple<name_t, StringIR<std::integer_sequence<char, namestring_t...>, positionInParameterTuple_t>, Value<size_t, bitwidthparameter_t>>, tail_t...>, LCTL_ALIGNED>>,base_t,inputsize_t,bitposition_t,parametername_t...>::compress(...)\n";
 #       endif
         // TODO might be another datatype
-        const base_t * runtimeParameter = std::get<positionInParameterTuple_t>(parameters);             
+        /* in SIMD cases, each lane of the vertical layout gets its own copy of the parameter */
+        base_t runtimeParameterLanes[LaneCount<processingStyle_t>::value];
+        for (size_t lane = 0; lane < LaneCount<processingStyle_t>::value; lane++)
+          runtimeParameterLanes[lane] = (base_t) *std::get<positionInParameterTuple_t>(parameters);
+        const base_t * runtimeParameter = runtimeParameterLanes;
         Write<
           processingStyle_t, 
           base_t, 
@@ -724,7 +816,7 @@ namespace LCTL {
         Incr<
           ((bitwidthparameter_t + bitposition_t) >= sizeof(compressedbase_t)*8), 
           compressedbase_t, 
-          (bitwidthparameter_t + bitposition_t)  / (sizeof(compressedbase_t)*8)
+          (bitwidthparameter_t + bitposition_t)  / (sizeof(compressedbase_t)*8) * LaneCount<processingStyle_t>::value
         >::apply(inBase);             
         Generator<
           processingStyle_t, 
@@ -12,6 +12,8 @@
 #include <typeinfo>
 #include <cxxabi.h>
 #include "../../Utils.h"
+#include "../../codegeneration/ProcessingStyle.h"
+#include "../../codegeneration/Tracks.h"
 #include "helper/findParameter.h"
 #include "helper/parameterList.h"
 
@@ -131,7 +133,7 @@ namespace LCTL {
               inBase, 
               tokensize, 
               outBase, 
-              std::tuple_cat(parametertuple, std::make_tuple(parameterptr))
+              appendParameter(parametertuple, parameterptr)
       );
       return;
     }   
@@ -165,7 +167,7 @@ namespace LCTL {
               name_t, 
               bitposition, 
               base_t
-          >::decode(inBase, parametertuple);
+          >::template decode<LaneCount<processingStyle_t>::value>(inBase, parametertuple);
       base_t* parameterptr = &parameter;
 #     if LCTL_VERBOSEDECOMPRESSIONCODE
         const char * g = name::GetString();
@@ -183,7 +185,7 @@ namespace LCTL {
               inBase, 
               tokensize, 
               outBase, 
-              std::tuple_cat(parametertuple, std::make_tuple(parameterptr))
+              appendParameter(parametertuple, parameterptr)
       );
       return;
     }
@@ -236,7 +238,7 @@ namespace LCTL {
     {
       /* I read, that this could make a Hashtable like a switch case */
       /* For reasons of simplicity, we need no "first", because in this case the parameter (bitwidth) is zero and there is nothing to encode */  
-      std::initializer_list<int> ({(( *(std::get<std::tuple_size< std::tuple<parameter_t...>>::value -1>(parameter)) == knownvalues_t::value) ?                  
+      std::initializer_list<int> ({(( *(std::get<LastParameter<std::tuple<parameter_t...>>::value>(parameter)) == knownvalues_t::value) ?                  
               (Generator<
               processingStyle_t, 
               typename knownvalues_t::next,
@@ -261,7 +263,7 @@ namespace LCTL {
 #     if LCTL_VERBOSEDECOMPRESSIONCODE
         std::cout << "// Decompress SwitchValue List\n";
 #     endif 
-      std::initializer_list<int> ({(*(std::get<std::tuple_size< std::tuple<parameter_t...>>::value -1>(parameter)) == knownvalues_t::value ?
+      std::initializer_list<int> ({(*(std::get<LastParameter<std::tuple<parameter_t...>>::value>(parameter)) == knownvalues_t::value ?
           (
               Generator<
               processingStyle_t, 
@@ -392,7 +394,7 @@ namespace LCTL {
       // TODO is not necessarrily base_t, might be size_t for tokensize
       // calcuklation of the adaptive parameters
       base_t parameter = numberOfBits_t > 0 
-              ? findParameter<next_t, name_t, bitposition, base_t, parametername_t...>::decode(inBase,parameters) 
+              ? findParameter<next_t, name_t, bitposition, base_t, parametername_t...>::template decode<LaneCount<processingStyle_t>::value>(inBase, parameters) 
               : logicalValue_t::inverse::apply(castOutBase , tokensize, parameters);
       // Update in parameterlist
       parameters = parameterList<name_t, 0, parametername_t...>::replace(&parameter, parameters);
@@ -478,9 +480,9 @@ namespace LCTL {
                   inBase, 
                   tokensize, 
                   outBase, 
-                  std::tuple_cat(
+                  appendParameter(
                       parameters,
-                      std::make_tuple(&parameter)
+                      &parameter
                   )
               );
           return;
@@ -504,7 +506,7 @@ namespace LCTL {
           // If physical value has a bitwidth > 0, try to find it,
           // if physical value has a bitwidth == 0, only calculate the inverse of the logical operation 
           base_t parameter = (base_t)((numberOfBits_t > 0)
-              ? findParameter<next_t, name, bitposition, base_t, parametername_t...>::decode(inBase,parameters)
+              ? findParameter<next_t, name, bitposition, base_t, parametername_t...>::template decode<LaneCount<processingStyle_t>::value>(inBase, parameters)
               : logicalValue_t::inverse::apply(inBase, tokensize, parameters));
 #if LCTL_VERBOSEDECOMPRESSIONCODE
           std::cout << (uint64_t) parameter << "; // UnknownValue\n";
@@ -522,9 +524,9 @@ namespace LCTL {
                   inBase, 
                   tokensize, 
                   outBase, 
-                  std::tuple_cat(
+                  appendParameter(
                       parameters,
-                      std::make_tuple(&parameter)
+                      &parameter
                   )
               );
           return;
@@ -9,7 +9,12 @@
 #define LCTL_TRANSFORMATIONS_CODEGENERATION_ROLLEDLOOPGENERATOR_H
 
 #include "./UnrolledLoop_TokenSize1_WOEncodedParameters_SimpleCombiner_Generator.h"
+#include "./helper/findParameter.h"
 #include "../../Definitions.h"
+#include "../../codegeneration/Increment.h"
+#include "../../codegeneration/ProcessingStyle.h"
+#include "../../codegeneration/RunLength.h"
+#include "../../codegeneration/Tracks.h"
 
 
 namespace LCTL {
@@ -286,6 +291,342 @@ namespace LCTL {
     }
     
   };
+
+  /**
+   * @brief We have a loop with a data dependent tokenizer (run-length encoding): each token is a run of equal values.
+   * The outer combiner concats the run length and the value of the run.
+   * The run length is written to one word of compressedbase_t (at most 2^numberOfBits_t - 1 values),
+   * the value uses the next ceil(sizeof(base_t)/sizeof(compressedbase_t)) words.
+   * The run detection compares whole vector registers and the decompression fills each run with broadcast stores
+   * (see codegeneration/RunLength.h).
+   *
+   * @tparam processingStyle_t   TVL Processing Style, contains also input granularity for scalar cases
+   * @tparam name_t              name of the run length
+   * @tparam numberOfBits_t      number of bits to encode the run length
+   * @tparam base_t              datatype of input column; is in scalar cases maybe not the same as base_t in processingStyle
+   * @tparam aligned_t           alignment of the outer combiner, each run starts at a word border
+   * @tparam bitposition         next value to encode starts at bitposition
+   * @tparam parametername_t...  names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    typename name_t,
+    size_t numberOfBits_t,
+    typename base_t,
+    bool aligned_t,
+    size_t bitposition,
+    typename... parametername_t>
+  struct Generator<
+    processingStyle_t,
+    RolledLoopIR<
+      UnknownTokenizerIR<RunTokenizer<name_t, Size<numberOfBits_t>>>,
+      Combiner<Concat<name_t, Token>, aligned_t>
+    >,
+    base_t,
+    0,
+    bitposition,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+    /* number of words for the value of a run */
+    static constexpr size_t valueWords = (sizeof(base_t) + sizeof(compressedbase_t) - 1) / sizeof(compressedbase_t);
+    /* the run length fits into numberOfBits_t bits and into one word */
+    static constexpr size_t lengthBits = numberOfBits_t < sizeof(compressedbase_t) * 8 ? numberOfBits_t : sizeof(compressedbase_t) * 8;
+    static constexpr size_t maxRunLength = lengthBits >= 64 ? SIZE_MAX : ((size_t) 1 << lengthBits) - 1;
+
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(
+            const base_t * & inBase,
+            const size_t countInLog,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<UnknownTokenizerIR<RunTokenizer<name_t, Size<numberOfBits_t>>>, Combiner<Concat<name_t, Token>, aligned_t>>,base_t,0,bitposition,parametername_t...>::compress(...)\n";
+#     endif
+      const base_t * inEnd = inBase + countInLog;
+      while (inBase < inEnd) {
+        const size_t remaining = (size_t) (inEnd - inBase);
+        const size_t runLength = findRunLength(inBase, remaining < maxRunLength ? remaining : maxRunLength);
+#       if LCTL_VERBOSECOMPRESSIONCODE
+          std::cout << "  // run of " << runLength << " values " << (uint64_t) *inBase << "\n";
+#       endif
+        *outBase = (compressedbase_t) runLength;
+        outBase++;
+        std::memset(outBase, 0, valueWords * sizeof(compressedbase_t));
+        std::memcpy(outBase, inBase, sizeof(base_t));
+        outBase += valueWords;
+        inBase += runLength;
+      }
+      return;
+    }
+
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decompress(
+            const compressedbase_t * & inBase,
+            const size_t countInLog,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<UnknownTokenizerIR<RunTokenizer<name_t, Size<numberOfBits_t>>>, Combiner<Concat<name_t, Token>, aligned_t>>,base_t,0,bitposition,parametername_t...>::decompress(...)\n";
+#     endif
+      const base_t * outEnd = outBase + countInLog;
+      while (outBase < outEnd) {
+        const size_t runLength = (size_t) *inBase;
+        inBase++;
+        base_t value;
+        std::memcpy(&value, inBase, sizeof(base_t));
+        inBase += valueWords;
+#       if LCTL_VERBOSEDECOMPRESSIONCODE
+          std::cout << "  // run of " << runLength << " values " << (uint64_t) value << "\n";
+#       endif
+        fillRun(outBase, value, runLength);
+        outBase += runLength;
+      }
+      return;
+    }
+  };
+
+  /**
+   * @brief Number of input values of a case of a SwitchTokenizerIR (tokensize of the unrolled inner loop)
+   */
+  template <typename case_t>
+  struct CaseTokensize;
+
+  template <
+    typename base_t,
+    typename name_t,
+    base_t logicalValue_t,
+    typename numberOfBits_t,
+    size_t inputsize_t,
+    typename tokenizer_t,
+    typename combiner_t,
+    typename outerCombiner_t
+  >
+  struct CaseTokensize<
+    KnownValueIR<
+      base_t,
+      name_t,
+      logicalValue_t,
+      numberOfBits_t,
+      UnrolledLoopIR<inputsize_t, tokenizer_t, combiner_t, outerCombiner_t>
+    >
+  > : std::integral_constant<size_t, inputsize_t> {};
+
+  /**
+   * @brief Number of bits of an encoded case of a SwitchTokenizerIR: the parameters in the outer combiner
+   * and the tokens of the unrolled inner loop, each encoded with the bitwidth of the case
+   */
+  template <typename case_t>
+  struct CaseBits;
+
+  template <
+    typename base_t,
+    typename name_t,
+    base_t logicalValue_t,
+    typename numberOfBits_t,
+    size_t inputsize_t,
+    typename logicalencoding_t,
+    typename bitwidthtype_t,
+    bitwidthtype_t bitwidth_t,
+    typename combiner_t,
+    typename... concat_t,
+    bool aligned_t
+  >
+  struct CaseBits<
+    KnownValueIR<
+      base_t,
+      name_t,
+      logicalValue_t,
+      numberOfBits_t,
+      UnrolledLoopIR<
+        inputsize_t,
+        KnownTokenizerIR<1, EncoderIR<logicalencoding_t, Value<bitwidthtype_t, bitwidth_t>, combiner_t>>,
+        combiner_t,
+        Combiner<Concat<concat_t...>, aligned_t>
+      >
+    >
+  > : std::integral_constant<size_t, ConcatBits<Concat<concat_t...>>::value + inputsize_t * bitwidth_t> {};
+
+  /**
+   * @brief We have a loop that can not be unrolled (an input with a runtime-known size) and a tokenizer
+   * with a small set of compiletime known cases (i.e. Simple-8b).
+   * Each case is an unrolled inner loop, i.e. a kernel without data dependent branches.
+   * In the compression direction, the selector is calculated with the calculation rule logicalValue_t,
+   * in the decompression direction, it is decoded. The kernel of the selected case is called via a jump table.
+   * Each case starts at a word (resp. register) border.
+   *
+   * @tparam processingStyle_t   TVL Processing Style, contains also input granularity for scalar cases
+   * @tparam name_t              name of the selector
+   * @tparam logicalValue_t      calculation rule for the selector
+   * @tparam numberOfBits_t      number of bits to encode the selector
+   * @tparam cases_t...          KnownValueIR with the selector and the unrolled loop of each case
+   * @tparam base_t              datatype of input column; is in scalar cases maybe not the same as base_t in processingStyle
+   * @tparam combiner_t          Combiner of rolled loop
+   * @tparam bitposition_t       next value to encode starts at bitposition
+   * @tparam parametername_t...  names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    typename name_t,
+    typename logicalValue_t,
+    typename numberOfBits_t,
+    typename... cases_t,
+    typename base_t,
+    typename combiner_t,
+    size_t bitposition_t,
+    typename... parametername_t>
+  struct Generator<
+    processingStyle_t,
+    RolledLoopIR<
+      SwitchTokenizerIR<name_t, logicalValue_t, numberOfBits_t, cases_t...>,
+      combiner_t
+    >,
+    base_t,
+    0,
+    bitposition_t,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+    /* the selector is encoded at the same position in each case, we search it in the combiner of the first case */
+    using firstcase_t = typename std::tuple_element<0, std::tuple<cases_t...>>::type;
+    /* number of input values of each case */
+    static constexpr size_t tokensizes[] = {CaseTokensize<cases_t>::value...};
+
+    /**
+     * @brief compression of one case: unrolled loop and alignment to the next word (resp. register) border
+     */
+    template <typename case_t, typename... parameter_t>
+    static void compressCase(
+            const base_t * & inBase,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+      Generator<
+        processingStyle_t,
+        typename case_t::next,
+        base_t,
+        CaseTokensize<case_t>::value,
+        bitposition_t,
+        parametername_t...
+      >::compress(inBase, CaseTokensize<case_t>::value, outBase, parameters);
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        if (CaseBits<case_t>::value % (sizeof(compressedbase_t)*8) != 0) std::cout << "  outBase";
+#     endif
+      IncrVector<(CaseBits<case_t>::value % (sizeof(compressedbase_t)*8) != 0), processingStyle_t>::apply(outBase);
+    }
+
+    /**
+     * @brief decompression of one case: unrolled loop and alignment to the next word (resp. register) border
+     */
+    template <typename case_t, typename... parameter_t>
+    static void decompressCase(
+            const compressedbase_t * & inBase,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+      Generator<
+        processingStyle_t,
+        typename case_t::next,
+        base_t,
+        CaseTokensize<case_t>::value,
+        bitposition_t,
+        parametername_t...
+      >::decompress(inBase, CaseTokensize<case_t>::value, outBase, parameters);
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        if (CaseBits<case_t>::value % (sizeof(compressedbase_t)*8) != 0) std::cout << "  inBase";
+#     endif
+      IncrVector<(CaseBits<case_t>::value % (sizeof(compressedbase_t)*8) != 0), processingStyle_t>::apply(inBase);
+    }
+
+    /**
+     * @brief implements the loop: calculation of the selector and call of the kernel of the selected case.
+     * If a value fits into no case (i.e. a value >= 2^60 in Simple-8b), it would be truncated by the last case,
+     * thus nothing is compressed: inBase and outBase are reset to their values at the beginning of the loop,
+     * and Compress returns the compressed size 0.
+     *
+     * @tparam parameters_t... types of runtime parameters
+     * @param inBase            uncompressed input data
+     * @param countInLog        number of logical input values
+     * @param outBase           memory region for compressed output data
+     * @param parameters        runtime parameters
+     */
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(
+            const base_t * & inBase,
+            const size_t countInLog,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<SwitchTokenizerIR<name_t, logicalValue_t, numberOfBits_t, cases_t...>,combiner_t>,base_t,0,bitposition_t,parametername_t...>::compress(...)\n";
+#     endif
+      using kernel_t = void (*)(const base_t * &, compressedbase_t * &, std::tuple<parameter_t...>);
+      static constexpr kernel_t kernels[] = {&compressCase<cases_t, parameter_t...>...};
+      compressedbase_t * outBaseStart = outBase;
+      size_t i = 0;
+      while (i < countInLog) {
+        const size_t selector = (size_t) logicalValue_t::apply(inBase, countInLog - i, parameters);
+        if (selector >= sizeof...(cases_t)) {
+#         if LCTL_VERBOSERUNTIME
+            std::cout << LCTL_WARNING << "Value " << (uint64_t) *inBase << " at position " << i << " does not fit into any case of the SwitchTokenizer. Nothing is compressed.\n";
+#         endif
+          inBase -= i;
+          outBase = outBaseStart;
+          return;
+        }
+#       if LCTL_VERBOSECOMPRESSIONCODE
+          std::cout << "  // selector " << selector << "\n";
+#       endif
+        kernels[selector](inBase, outBase, parameters);
+        i += tokensizes[selector];
+      }
+      return;
+    }
+
+    /**
+     * @brief implements the loop: decoding of the selector and call of the kernel of the selected case
+     *
+     * @tparam parameters_t... types of runtime parameters
+     * @param inBase            compressed input data
+     * @param countInLog        number of logical input values
+     * @param outBase           memory region for decompressed output data
+     * @param parameters        runtime parameters
+     */
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decompress(
+            const compressedbase_t * & inBase,
+            const size_t countInLog,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<SwitchTokenizerIR<name_t, logicalValue_t, numberOfBits_t, cases_t...>,combiner_t>,base_t,0,bitposition_t,parametername_t...>::decompress(...)\n";
+#     endif
+      using kernel_t = void (*)(const compressedbase_t * &, base_t * &, std::tuple<parameter_t...>);
+      static constexpr kernel_t kernels[] = {&decompressCase<cases_t, parameter_t...>...};
+      size_t i = 0;
+      while (i < countInLog) {
+        const size_t selector = (size_t) findParameter<
+          typename firstcase_t::next,
+          name_t,
+          bitposition_t,
+          base_t
+        >::template decode<LaneCount<processingStyle_t>::value>(inBase, parameters);
+#       if LCTL_VERBOSEDECOMPRESSIONCODE
+          std::cout << "  // selector " << selector << "\n";
+#       endif
+        kernels[selector](inBase, outBase, parameters);
+        i += tokensizes[selector];
+      }
+      return;
+    }
+  };
 }
 
 #endif /* LCTL_TRANSFORMATIONS_CODEGENERATION_ROLLEDLOOPGENERATOR_H */
@@ -0,0 +1,231 @@
+/*
+ * File:   RolledLoop_MeaningfulBitsCombiner_Generator.h
+ */
+
+#ifndef LCTL_TRANSFORMATIONS_CODEGENERATION_ROLLEDLOOPMEANINGFULBITSCOMBINER_H
+#define LCTL_TRANSFORMATIONS_CODEGENERATION_ROLLEDLOOPMEANINGFULBITSCOMBINER_H
+
+#include "../../Definitions.h"
+#include "../../language/calculation/Concat.h"
+#include "../../codegeneration/BitStream.h"
+#include <cstring>
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  template<
+    typename processingStyle_t,
+    typename node_t,
+    typename base_t,
+    size_t tokensize_t,
+    size_t bitposition,
+    typename... parametername_t
+  >
+  struct Generator;
+
+  /**
+   * @brief Encoder of a single value in a loop with a MeaningfulBits combiner.
+   * The encoder only calculates the logical value (i.e. the XOR with the previous value) and stores its bit pattern
+   * in one compressed word (resp. several words, if base_t is larger), the loop writes it into the bit stream.
+   * base_t can be a floating point datatype.
+   *
+   * @tparam processingStyle     TVL Processing Style, contains also datatype to handle the memory region of compressed and decompressed values
+   * @tparam logicalencoding_t   logical preprocessing function, i.e. Xor<Token, StringIR<...>>
+   * @tparam base_t              datatype of input column
+   * @tparam bitwidth_t          bitwidth of the logical value (not used, the loop removes leading and trailing zeros)
+   * @tparam aligned_t           alignment of the combiner (not used)
+   * @tparam bitposition_t       current bitposition (always 0)
+   * @tparam parametername_t...  names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    typename logicalencoding_t,
+    typename base_t,
+    size_t bitwidth_t,
+    bool aligned_t,
+    size_t bitposition_t,
+    typename... parametername_t
+  >
+  struct Generator<
+    processingStyle_t,
+    EncoderIR<
+      logicalencoding_t,
+      Value<size_t, bitwidth_t>,
+      Combiner<MeaningfulBits<Token>, aligned_t>
+    >,
+    base_t,
+    1,
+    bitposition_t,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(
+            const base_t * & inBase,
+            size_t countInLog,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, EncoderIR<logicalencoding_t,Value<size_t, bitwidth_t>,Combiner<MeaningfulBits<Token>, aligned_t>>,base_t,1,bitposition_t,parametername_t...>::compress(...)\n";
+#     endif
+      const base_t value = logicalencoding_t::apply(inBase, 1, parameters);
+      std::memcpy(outBase, &value, sizeof(base_t));
+      inBase++;
+      return;
+    }
+
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decompress(
+            const compressedbase_t * & inBase,
+            size_t countInLog,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, EncoderIR<logicalencoding_t,Value<size_t, bitwidth_t>,Combiner<MeaningfulBits<Token>, aligned_t>>,base_t,1,bitposition_t,parametername_t...>::decompress(...)\n";
+#     endif
+      std::memcpy(outBase, inBase, sizeof(base_t));
+      *outBase = logicalencoding_t::inverse::apply((const base_t *) outBase, 1, parameters);
+      outBase++;
+      return;
+    }
+  };
+
+  /**
+   * @brief Loop of single values with a MeaningfulBits combiner (Gorilla): the loop body (parameter calculations
+   * and the encoder, i.e. the XOR with the previous value) outputs the logical value of each token,
+   * which is written into one bit stream without its leading and trailing zeros:
+   * 0 if the value is 0,
+   * 10 and the bits in the window of the previous value, if the value has at least as many leading and trailing zeros,
+   * 11, 5 bits number of leading zeros, 6 bits number of meaningful bits minus one, and the meaningful bits otherwise.
+   * The bit stream ends at a word border.
+   *
+   * @tparam processingStyle_t   TVL Processing Style, contains also input granularity for scalar cases
+   * @tparam next_t              next node in the intermediate representation (loop body)
+   * @tparam base_t              datatype of input column, i.e. double
+   * @tparam aligned_t           alignment of the combiner (not used, the values are not aligned)
+   * @tparam bitposition_t       next value to encode starts at bitposition
+   * @tparam parametername_t...  names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    typename next_t,
+    typename base_t,
+    bool aligned_t,
+    size_t bitposition_t,
+    typename... parametername_t
+  >
+  struct Generator<
+    processingStyle_t,
+    RolledLoopIR<
+      KnownTokenizerIR<1, next_t>,
+      Combiner<MeaningfulBits<Token>, aligned_t>
+    >,
+    base_t,
+    0,
+    bitposition_t,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+    static constexpr size_t valueBits = sizeof(base_t) * 8;
+    /* number of compressed words for the logical value of one token */
+    static constexpr size_t valueWords = (sizeof(base_t) + sizeof(compressedbase_t) - 1) / sizeof(compressedbase_t);
+    /* the number of leading zeros is encoded with 5 bits */
+    static constexpr size_t maxLeadingZeros = 31;
+
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(
+            const base_t * & inBase,
+            const size_t countInLog,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<KnownTokenizerIR<1, next_t>, Combiner<MeaningfulBits<Token>, aligned_t>>,base_t,0,bitposition_t,parametername_t...>::compress(...)\n";
+#     endif
+      uint8_t * outStart = (uint8_t *) outBase;
+      BitWriter writer(outStart);
+      /* window of the previous value, initially invalid */
+      size_t leading = valueBits + 1;
+      size_t trailing = 0;
+      for (size_t i = 0; i < countInLog; i++) {
+        compressedbase_t word[valueWords] = {};
+        compressedbase_t * wordBase = word;
+        Generator<processingStyle_t, next_t, base_t, 1, bitposition_t, parametername_t...>::compress(inBase, 1, wordBase, parameters);
+        uint64_t value = 0;
+        std::memcpy(&value, word, sizeof(base_t));
+        if (value == 0) {
+          writer.put(0, 1);
+          continue;
+        }
+        size_t newLeading = __builtin_clzll(value) - (64 - valueBits);
+        const size_t newTrailing = __builtin_ctzll(value);
+        if (newLeading > maxLeadingZeros)
+          newLeading = maxLeadingZeros;
+        if (leading <= valueBits && newLeading >= leading && newTrailing >= trailing) {
+          /* control bits 1, 0 */
+          writer.put(1, 2);
+          writer.put(value >> trailing, valueBits - leading - trailing);
+        } else {
+          leading = newLeading;
+          trailing = newTrailing;
+          const size_t meaningful = valueBits - leading - trailing;
+#         if LCTL_VERBOSECOMPRESSIONCODE
+            std::cout << "  // new window: " << leading << " leading zeros, " << meaningful << " meaningful bits\n";
+#         endif
+          /* control bits 1, 1 */
+          writer.put(3, 2);
+          writer.put(leading, 5);
+          writer.put(meaningful - 1, 6);
+          writer.put(value >> trailing, meaningful);
+        }
+      }
+      const size_t bytes = (size_t) (writer.flush() - outStart);
+      const size_t words = (bytes + sizeof(compressedbase_t) - 1) / sizeof(compressedbase_t);
+      std::memset(outStart + bytes, 0, words * sizeof(compressedbase_t) - bytes);
+      outBase += words;
+      return;
+    }
+
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decompress(
+            const compressedbase_t * & inBase,
+            const size_t countInLog,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<KnownTokenizerIR<1, next_t>, Combiner<MeaningfulBits<Token>, aligned_t>>,base_t,0,bitposition_t,parametername_t...>::decompress(...)\n";
+#     endif
+      const uint8_t * inStart = (const uint8_t *) inBase;
+      BitReader reader(inStart);
+      size_t leading = 0;
+      size_t trailing = 0;
+      for (size_t i = 0; i < countInLog; i++) {
+        uint64_t value = 0;
+        if (reader.get(1) == 1) {
+          if (reader.get(1) == 1) {
+            leading = (size_t) reader.get(5);
+            trailing = valueBits - leading - ((size_t) reader.get(6) + 1);
+          }
+          value = reader.get(valueBits - leading - trailing) << trailing;
+        }
+        compressedbase_t word[valueWords] = {};
+        std::memcpy(word, &value, sizeof(base_t));
+        const compressedbase_t * wordBase = word;
+        Generator<processingStyle_t, next_t, base_t, 1, bitposition_t, parametername_t...>::decompress(wordBase, 1, outBase, parameters);
+      }
+      const size_t bytes = (size_t) (reader.position() - inStart);
+      inBase += (bytes + sizeof(compressedbase_t) - 1) / sizeof(compressedbase_t);
+      return;
+    }
+  };
+}
+
+#endif /* LCTL_TRANSFORMATIONS_CODEGENERATION_ROLLEDLOOPMEANINGFULBITSCOMBINER_H */
@@ -0,0 +1,309 @@
+/*
+ * File:   RolledLoop_MultipleConcatCombiner_Generator.h
+ */
+
+#ifndef LCTL_TRANSFORMATIONS_CODEGENERATION_ROLLEDLOOPMULTIPLECONCATCOMBINER_H
+#define LCTL_TRANSFORMATIONS_CODEGENERATION_ROLLEDLOOPMULTIPLECONCATCOMBINER_H
+
+#include "../../Definitions.h"
+#include "../../codegeneration/ShuffleTable.h"
+#include "../../codegeneration/Tracks.h"
+#include "../../language/calculation/Concat.h"
+#include <header/preprocessor.h>
+#include <cstring>
+#include <type_traits>
+
+namespace LCTL {
+
+  template<
+    typename processingStyle_t,
+    typename node_t,
+    typename base_t,
+    size_t tokensize_t,
+    size_t bitposition,
+    typename... parametername_t
+  >
+  struct Generator;
+
+  /**
+   * @brief Code generation for a loop over groups of four values, where each value is encoded with a byte length
+   * that is calculated per value and stored as 2 bit unit (number of bytes minus one) in front of the group (VarintGB).
+   * The outer combiner MultipleConcat<units, Token> concats the four units (one descriptor byte) and the data bytes.
+   * Compression calculates the units of the four values, writes the descriptor byte and the lowest bytes of each value.
+   * Decompression uses a lookup table with 256 shuffle masks indexed by the descriptor byte (see ShuffleTable.h),
+   * such that four 32 bit values are decoded with one load and one PSHUFB if SSSE3 is available.
+   * The last groups are decoded scalar, because the SIMD decoder reads up to 12 bytes behind the data bytes of a group.
+   * A data tail of less than four values is appended per memcpy like in the other rolled loops.
+   *
+   * @tparam processingStyle_t  TVL Processing Style, scalar<v8<uint8_t>>, because the compressed data are byte oriented
+   * @tparam name_t             name of the units parameter
+   * @tparam logicalValue_t     calculation rule of the units (number of bytes minus one)
+   * @tparam logicalencoding_t  logical preprocessing of the tokens, has to be Token
+   * @tparam physicalencoding_t bitwidth of the tokens (units plus one bytes)
+   * @tparam aligned_t          does not matter, the groups are byte aligned
+   * @tparam base_t             datatype of input column, up to 32 bits
+   * @tparam bitposition_t      0
+   * @tparam parametername_t... names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    typename name_t,
+    typename logicalValue_t,
+    typename logicalencoding_t,
+    typename physicalencoding_t,
+    bool aligned_t,
+    typename base_t,
+    size_t bitposition_t,
+    typename... parametername_t
+  >
+  struct Generator<
+    processingStyle_t,
+    RolledLoopIR<
+      KnownTokenizerIR<
+        4,
+        UnrolledLoopIR<
+          4,
+          KnownTokenizerIR<
+            1,
+            UnknownValueIR<
+              name_t,
+              logicalValue_t,
+              Size<2>,
+              EncoderIR<logicalencoding_t, physicalencoding_t, Combiner<Token, LCTL_UNALIGNED>>
+            >
+          >,
+          Combiner<Token, LCTL_UNALIGNED>,
+          Combiner<MultipleConcat<name_t, Token>, aligned_t>
+        >
+      >,
+      Combiner<MultipleConcat<name_t, Token>, aligned_t>
+    >,
+    base_t,
+    0,
+    bitposition_t,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+    static_assert(sizeof(compressedbase_t) == 1, "VarintGB needs a byte oriented processing style, i.e. scalar<v8<uint8_t>>");
+    /* the group encoder writes the lowest bytes of the input values, other logical encodings are not evaluated */
+    static_assert(std::is_same<logicalencoding_t, Token>::value, "VarintGB encodes the tokens without logical preprocessing (Encoder<Token, ...>)");
+    static_assert(sizeof(base_t) <= 4, "2 bit units encode at most 4 bytes per value");
+    /* smallest number of bytes of a group */
+    static constexpr size_t minGroupSize = 1 + 4;
+    /* number of groups at the end, which have to be decoded without reading behind the compressed data */
+    static constexpr size_t scalarGroups = (DecodeGroupVarint<base_t>::overread + minGroupSize - 1) / minGroupSize;
+
+    /**
+     * @param inBase            uncompressed input data
+     * @param countInLog        number of logical input values
+     * @param outBase           memory region for compressed output data
+     * @param parameters        runtime parameters
+     */
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(
+            const base_t * & inBase,
+            const size_t countInLog,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<KnownTokenizerIR<4, UnrolledLoopIR<...>>, Combiner<MultipleConcat<name_t, Token>, aligned_t>>,base_t,0,bitposition_t,parametername_t...>::compress(...)\n";
+#     endif
+      const size_t groups = countInLog / 4;
+      uint8_t * data = (uint8_t *) outBase;
+      for (size_t group = 0; group < groups; group++) {
+        uint8_t * descriptor = data++;
+        *descriptor = encodeGroupVarint(inBase, data);
+        inBase += 4;
+      }
+#     if LCTL_VERBOSERUNTIME
+        if (countInLog % 4)
+          std::cout << LCTL_WARNING << "Data tail (last "<< countInLog % 4 << " values) appended per memcpy, because blocksize of 4 values is not achieved.\n";
+#     endif
+      std::memcpy(data, inBase, sizeof(base_t) * (countInLog % 4));
+      outBase = (compressedbase_t *) (data + sizeof(base_t) * (countInLog % 4));
+      inBase += countInLog % 4;
+      return;
+    }
+
+    /**
+     * @param inBase            compressed input data
+     * @param countInLog        number of logical input values
+     * @param outBase           memory region for decompressed output data
+     * @param parameters        runtime parameters
+     */
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decompress(
+            const compressedbase_t * & inBase,
+            const size_t countInLog,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<KnownTokenizerIR<4, UnrolledLoopIR<...>>, Combiner<MultipleConcat<name_t, Token>, aligned_t>>,base_t,0,bitposition_t,parametername_t...>::decompress(...)\n";
+#     endif
+      const size_t groups = countInLog / 4;
+      const size_t fastGroups = groups > scalarGroups ? groups - scalarGroups : 0;
+      const uint8_t * data = (const uint8_t *) inBase;
+      size_t group = 0;
+      for (; group < fastGroups; group++) {
+        const uint8_t descriptor = *data++;
+        DecodeGroupVarint<base_t>::apply(descriptor, data, outBase);
+        outBase += 4;
+      }
+      for (; group < groups; group++) {
+        const uint8_t descriptor = *data++;
+        decodeGroupVarint(descriptor, data, outBase);
+        outBase += 4;
+      }
+      std::memcpy(outBase, data, sizeof(base_t) * (countInLog % 4));
+      inBase = (const compressedbase_t *) (data + sizeof(base_t) * (countInLog % 4));
+      outBase += countInLog % 4;
+      return;
+    }
+  };
+
+  /**
+   * @brief Code generation for groups of four values with 2 bit units per value like VarintGB (see above),
+   * but the outer combiner has two output tracks (Stream VByte): the descriptor bytes of all groups are written
+   * contiguously to the control track (descriptor track), the data bytes to the data track.
+   * Decompression decodes the data track with the shuffle table, the control track is read one byte per group.
+   * A data tail of less than four values is appended per memcpy to the data track.
+   *
+   * @tparam processingStyle_t  TVL Processing Style, scalar<v8<uint8_t>>, because the compressed data are byte oriented
+   * @tparam name_t             name of the units parameter
+   * @tparam logicalValue_t     calculation rule of the units (number of bytes minus one)
+   * @tparam logicalencoding_t  logical preprocessing of the tokens, has to be Token
+   * @tparam physicalencoding_t bitwidth of the tokens (units plus one bytes)
+   * @tparam data_t             combine function of the data track (analyzed)
+   * @tparam combiner_t         combiner of the rolled loop (not analyzed)
+   * @tparam aligned_t          does not matter, the groups are byte aligned
+   * @tparam base_t             datatype of input column, up to 32 bits
+   * @tparam bitposition_t      0
+   * @tparam parametername_t... names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    typename name_t,
+    typename logicalValue_t,
+    typename logicalencoding_t,
+    typename physicalencoding_t,
+    typename data_t,
+    typename combiner_t,
+    bool aligned_t,
+    typename base_t,
+    size_t bitposition_t,
+    typename... parametername_t
+  >
+  struct Generator<
+    processingStyle_t,
+    RolledLoopIR<
+      KnownTokenizerIR<
+        4,
+        UnrolledLoopIR<
+          4,
+          KnownTokenizerIR<
+            1,
+            UnknownValueIR<
+              name_t,
+              logicalValue_t,
+              Size<2>,
+              EncoderIR<logicalencoding_t, physicalencoding_t, Combiner<Token, LCTL_UNALIGNED>>
+            >
+          >,
+          Combiner<Token, LCTL_UNALIGNED>,
+          Combiner<Tracks<MultipleConcat<name_t>, data_t>, aligned_t>
+        >
+      >,
+      combiner_t
+    >,
+    base_t,
+    0,
+    bitposition_t,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+    static_assert(sizeof(compressedbase_t) == 1, "Stream VByte needs a byte oriented processing style, i.e. scalar<v8<uint8_t>>");
+    /* the group encoder writes the lowest bytes of the input values, other logical encodings are not evaluated */
+    static_assert(std::is_same<logicalencoding_t, Token>::value, "Stream VByte encodes the tokens without logical preprocessing (Encoder<Token, ...>)");
+    static_assert(sizeof(base_t) <= 4, "2 bit units encode at most 4 bytes per value");
+    /* smallest number of data bytes of a group */
+    static constexpr size_t minGroupSize = 4;
+    /* number of groups at the end, which have to be decoded without reading behind the data track */
+    static constexpr size_t scalarGroups = (DecodeGroupVarint<base_t>::overread + minGroupSize - 1) / minGroupSize;
+
+    /**
+     * @param inBase            uncompressed input data
+     * @param countInLog        number of logical input values
+     * @param outBase           data track
+     * @param parameters        runtime parameters, the last one is DescriptorTrack<compressedbase_t> *
+     */
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void compress(
+            const base_t * & inBase,
+            const size_t countInLog,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<KnownTokenizerIR<4, UnrolledLoopIR<...>>, Combiner<Tracks<MultipleConcat<name_t>, data_t>, aligned_t>>,base_t,0,bitposition_t,parametername_t...>::compress(...)\n";
+#     endif
+      compressedbase_t * & control = std::get<DescriptorTrack<compressedbase_t> *>(parameters)->base;
+      const size_t groups = countInLog / 4;
+      uint8_t * data = (uint8_t *) outBase;
+      for (size_t group = 0; group < groups; group++) {
+        *control++ = encodeGroupVarint(inBase, data);
+        inBase += 4;
+      }
+#     if LCTL_VERBOSERUNTIME
+        if (countInLog % 4)
+          std::cout << LCTL_WARNING << "Data tail (last "<< countInLog % 4 << " values) appended per memcpy, because blocksize of 4 values is not achieved.\n";
+#     endif
+      std::memcpy(data, inBase, sizeof(base_t) * (countInLog % 4));
+      outBase = (compressedbase_t *) (data + sizeof(base_t) * (countInLog % 4));
+      inBase += countInLog % 4;
+      return;
+    }
+
+    /**
+     * @param inBase            data track
+     * @param countInLog        number of logical input values
+     * @param outBase           memory region for decompressed output data
+     * @param parameters        runtime parameters, the last one is DescriptorTrack<const compressedbase_t> *
+     */
+    template<typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static void decompress(
+            const compressedbase_t * & inBase,
+            const size_t countInLog,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters)
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, RolledLoopIR<KnownTokenizerIR<4, UnrolledLoopIR<...>>, Combiner<Tracks<MultipleConcat<name_t>, data_t>, aligned_t>>,base_t,0,bitposition_t,parametername_t...>::decompress(...)\n";
+#     endif
+      const compressedbase_t * & control = std::get<DescriptorTrack<const compressedbase_t> *>(parameters)->base;
+      const size_t groups = countInLog / 4;
+      const size_t fastGroups = groups > scalarGroups ? groups - scalarGroups : 0;
+      const uint8_t * data = (const uint8_t *) inBase;
+      size_t group = 0;
+      for (; group < fastGroups; group++) {
+        DecodeGroupVarint<base_t>::apply(*control++, data, outBase);
+        outBase += 4;
+      }
+      for (; group < groups; group++) {
+        decodeGroupVarint(*control++, data, outBase);
+        outBase += 4;
+      }
+      std::memcpy(outBase, data, sizeof(base_t) * (countInLog % 4));
+      inBase = (const compressedbase_t *) (data + sizeof(base_t) * (countInLog % 4));
+      outBase += countInLog % 4;
+      return;
+    }
+  };
+}
+
+#endif /* LCTL_TRANSFORMATIONS_CODEGENERATION_ROLLEDLOOPMULTIPLECONCATCOMBINER_H */
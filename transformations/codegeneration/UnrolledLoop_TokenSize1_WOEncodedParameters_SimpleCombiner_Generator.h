@@ -10,6 +10,7 @@
 
 #include "../../Definitions.h"
 #include "../../intermediate/procedure/Concepts.h"
+#include "../../codegeneration/ProcessingStyle.h"
 
 namespace LCTL {
   
@@ -114,11 +115,12 @@ namespace LCTL {
           >::compress(inBase, tokensize, outBase, parameters);
           /**
            * inBase has to be increased by x, iff tokensize is x.
+           * In SIMD cases, one token per lane has been written.
            */
 #         if LCTL_VERBOSECOMPRESSIONCODE
             std::cout << "  inBase ";
 #         endif
-          Incr<true, base_t, 1>::apply(inBase);
+          Incr<true, base_t, LaneCount<processingStyle_t>::value>::apply(inBase);
           Generator<
             processingStyle_t, 
             UnrolledLoopIR<
@@ -131,7 +133,7 @@ namespace LCTL {
               Combiner<Token, LCTL_ALIGNED>
               >,
               base_t,
-              remainingValuesToWrite_t-1,
+              remainingValuesToWrite_t - LaneCount<processingStyle_t>::value,
               (bitposition_t + bitwidth_t) % (sizeof(compressedbase_t)*8),
               parametername_t...
           >::compress(inBase, tokensize, outBase, parameters);
@@ -172,7 +174,7 @@ namespace LCTL {
           std::cout << "// Decompress Unrolled Loop 1\n";
           std::cout << "  outBase ";
 #       endif
-        Incr<true, base_t, 1>::apply(outBase);  
+        Incr<true, base_t, LaneCount<processingStyle_t>::value>::apply(outBase);  
         Generator<
           processingStyle_t, 
           UnrolledLoopIR<
@@ -185,7 +187,7 @@ namespace LCTL {
             Combiner<Token, LCTL_ALIGNED>
           >,
           base_t,
-          remainingValuesToWrite_t-1,
+          remainingValuesToWrite_t - LaneCount<processingStyle_t>::value,
           (bitposition_t + bitwidth_t) % (sizeof(compressedbase_t)*8),
           parametername_t...
         >::decompress(inBase, tokensize, outBase, parameters);
@@ -259,7 +261,7 @@ namespace LCTL {
           //  if (bitposition_t != 0) std::cout << "  outBase ";
 #         //endif
           //  std::cout << "Increase outbase at the end of block " << (bitposition_t != 0? "yes" : "no") << "\n";
-          Incr<bitposition_t != 0, compressedbase_t, 1>::apply(outBase);  
+          IncrVector<bitposition_t != 0, processingStyle_t>::apply(outBase);  
           return 0;
       }
 
@@ -286,7 +288,7 @@ namespace LCTL {
           std::cout << "// Decompress Unrolled Loop 2\n";
           if (bitposition_t != 0) std::cout << "  inBase ";
 #       endif
-        Incr<bitposition_t != 0, base_t, 1>::apply(inBase);    
+        IncrVector<bitposition_t != 0, processingStyle_t>::apply(inBase);    
 
         return 0;
     }
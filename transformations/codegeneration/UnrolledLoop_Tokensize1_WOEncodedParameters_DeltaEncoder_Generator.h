@@ -0,0 +1,147 @@
+/*
+ * File:   UnrolledLoop_Tokensize1_WOEncodedParameters_DeltaEncoder_Generator.h
+ */
+
+#ifndef LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPDELTAENCODER_H
+#define LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPDELTAENCODER_H
+
+#include "../../Definitions.h"
+#include "../../language/calculation/Concat.h"
+#include "../../language/calculation/arithmetics.h"
+#include "../../codegeneration/PrefixSum.h"
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  template<
+    typename processingStyle_t,
+    typename node_t,
+    typename base_t,
+    size_t tokensize_t,
+    size_t bitposition,
+    typename... parametername_t
+  >
+  struct Generator;
+
+  /**
+   * @brief  Code Generation for an unrolled loop containing a tokenizer outputting single values,
+   * which are encoded as differences inside of the block (Delta<Token, ref_t, distance_t>, i.e. deltabp and delta4bp).
+   *
+   * Compression: The differences of the whole block have been calculated into the block buffer of Delta by 
+   * Bitwidth<MaxIR<Delta<...>>>, which determines the bitwidth of the block, afterwards they are bit packed
+   * with the usual code generation for the data block. Without a preceding bitwidth calculation of the block
+   * (i.e. a static bitwidth), the differences are calculated here.
+   *
+   * Decompression: The whole data block of differences is unpacked without dependencies between the values,
+   * afterwards the values are restored in place with a (SIMD) prefix sum, see LCTL/codegeneration/PrefixSum.h.
+   *
+   * @tparam processingStyle     TVL Processing Style, contains also datatype to handle the memory region of compressed and decompressed values
+   * @tparam inputs_t            blocksize (tokensize of the outer tokenizer)
+   * @tparam bitwidth_t          bitwidth of the differences in the block
+   * @tparam base_t              datatype of input column; is in scalar cases maybe not the same as base_t in processingStyle
+   * @tparam inputsize_t         number of single values of the block that are not yet written to the output
+   * @tparam bitposition         bitposition in the output address, to which the first encoded value has to be leftshifted
+   * @tparam ref_t               reference value for the first distance_t values of the block, i.e. StringIR<...>
+   * @tparam distance_t          distance of the subtrahend
+   * @tparam tail...             parameters in the outer combiner that have to be written to the output after the data block
+   * @tparam parametername_t...  names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    size_t inputs_t,
+    size_t bitwidth_t,
+    typename base_t,
+    size_t inputsize_t,
+    size_t bitposition,
+    typename ref_t,
+    size_t distance_t,
+    typename... tail_t,
+    typename... parametername_t
+  >
+  struct Generator<
+    processingStyle_t,
+    UnrolledLoopIR<
+      inputs_t,
+      KnownTokenizerIR<
+        1,
+        EncoderIR<
+          Delta<Token, ref_t, distance_t>,
+          Value<size_t, bitwidth_t>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >
+      >,
+      Combiner<Token, LCTL_UNALIGNED>,
+      Combiner<Concat<std::tuple<Token, Token, NIL>, tail_t...>, LCTL_ALIGNED>
+    >,
+    base_t,
+    inputsize_t,
+    bitposition,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+
+    /* data block of differences */
+    using block_t = Generator<
+      processingStyle_t,
+      UnrolledLoopIR<
+        inputs_t,
+        KnownTokenizerIR<
+          1,
+          EncoderIR<  Token, Value<size_t,bitwidth_t>, Combiner<Token,  LCTL_UNALIGNED> >
+        >,
+        Combiner<Token,  LCTL_UNALIGNED>,
+        Combiner<Concat<std::tuple<Token, Token, NIL>, tail_t...>, LCTL_ALIGNED>
+      >,
+      base_t,
+      inputsize_t,
+      bitposition,
+      parametername_t...
+    >;
+
+    template <typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t compress(
+            const base_t * & inBase,
+            const size_t tokensize,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters )
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, UnrolledLoopIR<inputs_t, KnownTokenizerIR<1,EncoderIR<Delta<Token, ref_t, distance_t>, Value<size_t, bitwidth_t>, Combiner<Token, LCTL_UNALIGNED>>>, Combiner<Token, LCTL_UNALIGNED>, Combiner<Concat<std::tuple<Token, Token, NIL>, tail_t...>, LCTL_ALIGNED>>, base_t, inputsize_t, bitposition, parametername_t...>::compress(...)\n";
+#     endif
+      auto & block = Delta<Token, ref_t, distance_t>::template block<inputs_t, base_t>();
+      if (block.in != inBase)
+        Delta<Token, ref_t, distance_t>::template apply<inputs_t>(inBase, block.differences, parameters);
+      /* the buffer is used once, a later column at the same address is calculated again */
+      block.in = nullptr;
+      const base_t * deltaBase = block.differences;
+      block_t::compress(deltaBase, tokensize, outBase, parameters);
+      inBase += inputs_t;
+      return 0;
+    }
+
+    template <typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t decompress(
+            const compressedbase_t * & inBase,
+            const size_t tokensize,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters )
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, UnrolledLoopIR<inputs_t, KnownTokenizerIR<1,EncoderIR<Delta<Token, ref_t, distance_t>, Value<size_t, bitwidth_t>, Combiner<Token, LCTL_UNALIGNED>>>, Combiner<Token, LCTL_UNALIGNED>, Combiner<Concat<std::tuple<Token, Token, NIL>, tail_t...>, LCTL_ALIGNED>>, base_t, inputsize_t, bitposition, parametername_t...>::decompress(...)\n";
+#     endif
+      base_t * outStart = outBase;
+      block_t::decompress(inBase, tokensize, outBase, parameters);
+      const base_t * referenceBase = outStart;
+      const base_t reference = (base_t) ref_t::apply(referenceBase, inputs_t, parameters);
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        std::cout << "// prefix sum of " << inputs_t << " differences with distance " << distance_t << "\n";
+#     endif
+      PrefixSum<distance_t, base_t>::apply(outStart, inputs_t, reference);
+      return 0;
+    }
+  };
+}
+
+#endif /* LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPDELTAENCODER_H */
@@ -0,0 +1,216 @@
+/*
+ * File:   UnrolledLoop_Tokensize1_WOEncodedParameters_ExceptionsCombiner_Generator.h
+ */
+
+#ifndef LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPEXCEPTIONSCOMBINER_H
+#define LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPEXCEPTIONSCOMBINER_H
+
+#include "../../Definitions.h"
+#include "../../language/calculation/Concat.h"
+#include <cstring>
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  template<
+    typename processingStyle_t,
+    typename node_t,
+    typename base_t,
+    size_t tokensize_t,
+    size_t bitposition,
+    typename... parametername_t
+  >
+  struct Generator;
+
+  /**
+   * @brief  Code Generation for an unrolled loop containing a tokenizer outputting single values,
+   * where the outer combiner concats the data block and an exception list (patch area), i.e. PFOR.
+   *
+   * Compression: The lowest bitwidth_t bits of each value are bit packed with the usual code generation for the data block.
+   * Each value with more bits is an exception. Behind the data block, the patch area contains
+   * the number of exceptions (uint16_t), and for each exception its position in the block (uint16_t)
+   * and its higher bits (value >> bitwidth_t, sizeof(base_t) bytes).
+   * The patch area is padded to the next word (resp. register) border.
+   *
+   * Decompression: The whole data block is unpacked without branches, afterwards the exceptions are patched.
+   *
+   * @tparam processingStyle     TVL Processing Style, contains also datatype to handle the memory region of compressed and decompressed values
+   * @tparam inputs_t            blocksize (tokensize of the outer tokenizer)
+   * @tparam bitwidth_t          bitwidth of the data values in the block
+   * @tparam base_t              datatype of input column; is in scalar cases maybe not the same as base_t in processingStyle
+   * @tparam inputsize_t         number of single values of the block that are not yet written to the output
+   * @tparam bitposition         bitposition in the output address, to which the first encoded value has to be leftshifted
+   * @tparam logicalencoding_t   logical preprocessing function for before writing the value to the output
+   * @tparam exceptionslogical_t logical value of the exceptions element (not used)
+   * @tparam exceptionsbits_t    number of bits of the exceptions element (not used, the patch area has a variable size)
+   * @tparam tail...             parameters in the outer combiner that have to be written to the output after the patch area
+   * @tparam parametername_t...  names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    size_t inputs_t,
+    size_t bitwidth_t,
+    typename base_t,
+    size_t inputsize_t,
+    size_t bitposition,
+    typename logicalencoding_t,
+    typename exceptionslogical_t,
+    typename exceptionsbits_t,
+    typename... tail_t,
+    typename... parametername_t
+  >
+  struct Generator<
+    processingStyle_t,
+    UnrolledLoopIR<
+      inputs_t,
+      KnownTokenizerIR<
+        1,
+        EncoderIR<
+          logicalencoding_t,
+          Value<size_t, bitwidth_t>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >
+      >,
+      Combiner<Token, LCTL_UNALIGNED>,
+      Combiner<
+        Concat<
+          std::tuple<Token, Token, NIL>,
+          std::tuple<Exceptions, exceptionslogical_t, exceptionsbits_t>,
+          tail_t...
+        >,
+        LCTL_ALIGNED
+      >
+    >,
+    base_t,
+    inputsize_t,
+    bitposition,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+    /* values with more bits are exceptions */
+    static constexpr bool hasExceptions = bitwidth_t < sizeof(base_t) * 8;
+    static constexpr base_t mask = hasExceptions ? (base_t) (((uint64_t) 1 << bitwidth_t) - 1) : (base_t) ~((base_t) 0);
+    /* the patch area ends at a word (resp. register) border */
+    static constexpr size_t alignment = sizeof(compressedbase_t) * LaneCount<processingStyle_t>::value;
+
+    /* data block without exceptions */
+    template <typename concat_t>
+    using block_t = Generator<
+      processingStyle_t,
+      UnrolledLoopIR<
+        inputs_t,
+        KnownTokenizerIR<
+          1,
+          EncoderIR<  logicalencoding_t, Value<size_t,bitwidth_t>, Combiner<Token,  LCTL_UNALIGNED> >
+        >,
+        Combiner<Token,  LCTL_UNALIGNED>,
+        Combiner<concat_t, LCTL_ALIGNED>
+      >,
+      base_t,
+      inputsize_t,
+      bitposition,
+      parametername_t...
+    >;
+
+    template <typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t compress(
+            const base_t * & inBase,
+            const size_t tokensize,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters )
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, UnrolledLoopIR<inputs_t, KnownTokenizerIR<1,EncoderIR<logicalencoding_t, Value<size_t, bitwidth_t>, Combiner<Token, LCTL_UNALIGNED>>>, Combiner<Token, LCTL_UNALIGNED>, Combiner<Concat<std::tuple<Token, Token, NIL>, std::tuple<Exceptions, exceptionslogical_t, exceptionsbits_t>, tail_t...>, LCTL_ALIGNED>>, base_t, inputsize_t, bitposition, parametername_t...>::compress(...)\n";
+#     endif
+      /* lowest bits of each value */
+      base_t low[inputs_t];
+      for (size_t i = 0; i < inputs_t; i++)
+        low[i] = inBase[i] & mask;
+      const base_t * lowBase = low;
+      block_t<Concat<std::tuple<Token, Token, NIL>>>::compress(lowBase, tokensize, outBase, parameters);
+
+      /* patch area */
+      uint8_t * patch8 = (uint8_t *) outBase;
+      uint8_t * count8 = patch8;
+      patch8 += sizeof(uint16_t);
+      uint16_t count = 0;
+      if (hasExceptions) {
+        for (size_t i = 0; i < inputs_t; i++) {
+          const base_t high = (base_t) (inBase[i] >> (hasExceptions ? bitwidth_t : 0));
+          if (high != 0) {
+            const uint16_t position = (uint16_t) i;
+            std::memcpy(patch8, &position, sizeof(uint16_t));
+            std::memcpy(patch8 + sizeof(uint16_t), &high, sizeof(base_t));
+            patch8 += sizeof(uint16_t) + sizeof(base_t);
+            count++;
+          }
+        }
+      }
+      std::memcpy(count8, &count, sizeof(uint16_t));
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        std::cout << "// " << count << " exceptions in the patch area\n";
+#     endif
+      const size_t patchsize = (patch8 - count8 + alignment - 1) / alignment * alignment;
+      std::memset(patch8, 0, count8 + patchsize - patch8);
+      outBase = (compressedbase_t *) (count8 + patchsize);
+      inBase += inputs_t;
+
+      Generator<
+        processingStyle_t,
+        UnrolledLoopIR<
+          inputs_t,
+          KnownTokenizerIR<
+            1,
+            EncoderIR<  logicalencoding_t, Value<size_t,bitwidth_t>, Combiner<Token,  LCTL_UNALIGNED> >
+          >,
+          Combiner<Token,  LCTL_UNALIGNED>,
+          Combiner<Concat<tail_t...>, LCTL_ALIGNED>
+        >,
+        base_t,
+        inputs_t,
+        0,
+        parametername_t...
+      >::compress(inBase, tokensize, outBase, parameters);
+      return 0;
+    }
+
+    template <typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static size_t decompress(
+            const compressedbase_t * & inBase,
+            const size_t tokensize,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters )
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, UnrolledLoopIR<inputs_t, KnownTokenizerIR<1,EncoderIR<logicalencoding_t, Value<size_t, bitwidth_t>, Combiner<Token, LCTL_UNALIGNED>>>, Combiner<Token, LCTL_UNALIGNED>, Combiner<Concat<std::tuple<Token, Token, NIL>, std::tuple<Exceptions, exceptionslogical_t, exceptionsbits_t>, tail_t...>, LCTL_ALIGNED>>, base_t, inputsize_t, bitposition, parametername_t...>::decompress(...)\n";
+#     endif
+      base_t * outStart = outBase;
+      block_t<Concat<std::tuple<Token, Token, NIL>>>::decompress(inBase, tokensize, outBase, parameters);
+
+      /* patch the exceptions */
+      const uint8_t * patch8 = (const uint8_t *) inBase;
+      const uint8_t * count8 = patch8;
+      uint16_t count;
+      std::memcpy(&count, patch8, sizeof(uint16_t));
+      patch8 += sizeof(uint16_t);
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        std::cout << "// patch " << count << " exceptions\n";
+#     endif
+      for (uint16_t e = 0; e < count; e++) {
+        uint16_t position;
+        base_t high;
+        std::memcpy(&position, patch8, sizeof(uint16_t));
+        std::memcpy(&high, patch8 + sizeof(uint16_t), sizeof(base_t));
+        outStart[position] |= (base_t) (high << (hasExceptions ? bitwidth_t : 0));
+        patch8 += sizeof(uint16_t) + sizeof(base_t);
+      }
+      const size_t patchsize = (patch8 - count8 + alignment - 1) / alignment * alignment;
+      inBase = (const compressedbase_t *) (count8 + patchsize);
+      return 0;
+    }
+  };
+}
+
+#endif /* LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPEXCEPTIONSCOMBINER_H */
@@ -101,7 +101,7 @@ namespace LCTL {
 #     if LCTL_VERBOSECOMPRESSIONCODE
         std::cout << "  inBase ";
 #     endif
-      Incr<true, base_t, 1>::apply(inBase); 
+      Incr<true, base_t, LaneCount<processingStyle_t>::value>::apply(inBase); 
       Generator<
         processingStyle_t, 
         UnrolledLoopIR<
@@ -114,7 +114,7 @@ namespace LCTL {
           Combiner<Concat<std::tuple<Token, Token, NIL>, tail_t...>, LCTL_ALIGNED>
         >,
         base_t,
-        inputsize_t-1,
+        inputsize_t - LaneCount<processingStyle_t>::value,
         (bitposition + bitwidth_t) % (sizeof(compressedbase_t)*8),
         parametername_t...
       >::compress(inBase, tokensize, outBase, parameters);
@@ -143,7 +143,7 @@ namespace LCTL {
         std::cout << "  outBase";
 #     endif
         
-      Incr<true, base_t, 1 >::apply(outBase);
+      Incr<true, base_t, LaneCount<processingStyle_t>::value>::apply(outBase);
       
       Generator<
         processingStyle_t, 
@@ -157,7 +157,7 @@ namespace LCTL {
           Combiner<Concat<std::tuple<Token, Token, NIL>, tail_t...>, LCTL_ALIGNED>
         >,
         base_t,
-        inputsize_t-1,
+        inputsize_t - LaneCount<processingStyle_t>::value,
         (bitposition + bitwidth_t) % (sizeof(compressedbase_t)*8),
         parametername_t...
       >::decompress(inBase, tokensize, outBase, parameters);
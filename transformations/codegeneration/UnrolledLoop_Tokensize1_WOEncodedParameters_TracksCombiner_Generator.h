@@ -0,0 +1,161 @@
+/*
+ * File:   UnrolledLoop_Tokensize1_WOEncodedParameters_TracksCombiner_Generator.h
+ */
+
+#ifndef LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPTRACKSCOMBINER_H
+#define LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPTRACKSCOMBINER_H
+
+#include "../../Definitions.h"
+#include "../../codegeneration/Increment.h"
+#include "../../codegeneration/Tracks.h"
+#include <header/preprocessor.h>
+
+namespace LCTL {
+
+  template<
+    typename processingStyle_t,
+    typename node_t,
+    typename base_t,
+    size_t tokensize_t,
+    size_t bitposition,
+    typename... parametername_t
+  >
+  struct Generator;
+
+  /**
+   * @brief  Code Generation for an unrolled loop containing a tokenizer outputting single values which are encoded without calculating parameters.
+   * The outer combiner has two output tracks: the first one for descriptors (parameters), the second one for the data.
+   * Both tracks are written one after the other with the usual concat combiner code generation:
+   * the descriptor track with the current address in the descriptor track (last element of the runtime parameter tuple)
+   * and the data track with the usual outBase (compression) or inBase (decompression).
+   * The descriptors of each block start at a word (resp. register) border. Thus, the data track contains no parameters
+   * and each block of the data track starts at a word (resp. register) border if the block does.
+   *
+   * @tparam processingStyle     TVL Processing Style, contains also datatype to handle the memory region of compressed and decompressed values
+   * @tparam tokensizeOuterLoop_t blocksize (tokensize of the outer tokenizer)
+   * @tparam bitwidthtype_t      type of bitwidth_t
+   * @tparam bitwidth_t          bitwidth of the data values
+   * @tparam base_t              datatype of input column; is in scalar cases maybe not the same as base_t in processingStyle
+   * @tparam inputsize_t         number of single values of the block that are not yet written to the output
+   * @tparam bitposition         bitposition in the data track
+   * @tparam logicalencoding_t   logical preprocessing function for before writing the value to the output
+   * @tparam descriptors_t       combine function of the descriptor track
+   * @tparam data_t              combine function of the data track
+   * @tparam parametername_t...  names of runtime parameters
+   */
+  template<
+    typename processingStyle_t,
+    size_t tokensizeOuterLoop_t,
+    typename bitwidthtype_t,
+    bitwidthtype_t bitwidth_t,
+    typename base_t,
+    size_t inputsize_t,
+    size_t bitposition,
+    typename logicalencoding_t,
+    typename descriptors_t,
+    typename data_t,
+    typename... parametername_t
+  >
+  struct Generator<
+    processingStyle_t,
+    UnrolledLoopIR<
+      tokensizeOuterLoop_t,
+      KnownTokenizerIR<
+        1,
+        EncoderIR<
+          logicalencoding_t,
+          Value<bitwidthtype_t, bitwidth_t>,
+          Combiner<Token, LCTL_UNALIGNED>
+        >
+      >,
+      Combiner<Token, LCTL_UNALIGNED>,
+      Combiner<Tracks<descriptors_t, data_t>, LCTL_ALIGNED>
+    >,
+    base_t,
+    inputsize_t,
+    bitposition,
+    parametername_t...>
+  {
+    using compressedbase_t = typename processingStyle_t::base_t;
+
+    template <typename combine_t>
+    using track_t = UnrolledLoopIR<
+      tokensizeOuterLoop_t,
+      KnownTokenizerIR<
+        1,
+        EncoderIR<  logicalencoding_t, Value<size_t,bitwidth_t>, Combiner<Token, LCTL_UNALIGNED> >
+      >,
+      Combiner<Token, LCTL_UNALIGNED>,
+      Combiner<combine_t, LCTL_ALIGNED>
+    >;
+
+    /* the descriptors of the next block start at a word (resp. register) border */
+    static constexpr bool alignDescriptors = (ConcatBits<descriptors_t>::value % (sizeof(compressedbase_t)*8)) != 0;
+
+    /**
+     * @brief writes the descriptors of the block to the descriptor track and the data to the data track
+     *
+     * @tparam parameter_t... types of runtime parameters, the last one is DescriptorTrack<compressedbase_t> *
+     * @param inBase            uncompressed input data
+     * @param tokensize         number of logical input values
+     * @param outBase           data track
+     * @param parameters        runtime parameters
+     */
+    template <typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint8_t * compress(
+            const base_t * & inBase,
+            const size_t tokensize,
+            compressedbase_t * & outBase,
+            std::tuple<parameter_t...> parameters )
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, UnrolledLoopIR<tokensizeOuterLoop_t, KnownTokenizerIR<1,EncoderIR< logicalencoding_t, Value<bitwidthtype_t, bitwidth_t>, Combiner<Token, LCTL_UNALIGNED> >>, Combiner<Token, LCTL_UNALIGNED>,Combiner<Tracks<descriptors_t, data_t>, LCTL_ALIGNED>>,base_t,inputsize_t,bitposition, parametername_t...>::compress(...)\n";
+#     endif
+      compressedbase_t * & descriptorBase = std::get<DescriptorTrack<compressedbase_t> *>(parameters)->base;
+      Generator<processingStyle_t, track_t<descriptors_t>, base_t, inputsize_t, 0, parametername_t...>
+        ::compress(inBase, tokensize, descriptorBase, parameters);
+#     if LCTL_VERBOSECOMPRESSIONCODE
+        if (alignDescriptors) std::cout << "  descriptorBase";
+#     endif
+      IncrVector<alignDescriptors, processingStyle_t>::apply(descriptorBase);
+      Generator<processingStyle_t, track_t<data_t>, base_t, inputsize_t, bitposition, parametername_t...>
+        ::compress(inBase, tokensize, outBase, parameters);
+      return (uint8_t *) outBase;
+    }
+
+    /**
+     * @brief skips the descriptors of the block in the descriptor track (they are decoded before) and decodes the data track
+     *
+     * @tparam parameter_t... types of runtime parameters, the last one is DescriptorTrack<const compressedbase_t> *
+     * @param inBase            data track
+     * @param tokensize         number of logical input values
+     * @param outBase           memory region for decompressed output data
+     * @param parameters        runtime parameters
+     */
+    template <typename... parameter_t>
+    MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint8_t * decompress(
+            const compressedbase_t * & inBase,
+            const size_t tokensize,
+            base_t * & outBase,
+            std::tuple<parameter_t...> parameters )
+    {
+#     if LCTL_VERBOSECALLGRAPH
+        std::cout << __FILE__ << ", line " << __LINE__ <<  ":\n";
+        std::cout << "\tGenerator<processingStyle_t, UnrolledLoopIR<tokensizeOuterLoop_t, KnownTokenizerIR<1,EncoderIR< logicalencoding_t, Value<bitwidthtype_t, bitwidth_t>, Combiner<Token, LCTL_UNALIGNED> >>, Combiner<Token, LCTL_UNALIGNED>,Combiner<Tracks<descriptors_t, data_t>, LCTL_ALIGNED>>,base_t,inputsize_t,bitposition, parametername_t...>::decompress(...)\n";
+#     endif
+      const compressedbase_t * & descriptorBase = std::get<DescriptorTrack<const compressedbase_t> *>(parameters)->base;
+      Generator<processingStyle_t, track_t<descriptors_t>, base_t, inputsize_t, 0, parametername_t...>
+        ::decompress(descriptorBase, tokensize, outBase, parameters);
+#     if LCTL_VERBOSEDECOMPRESSIONCODE
+        if (alignDescriptors) std::cout << "  descriptorBase";
+#     endif
+      IncrVector<alignDescriptors, processingStyle_t>::apply(descriptorBase);
+      Generator<processingStyle_t, track_t<data_t>, base_t, inputsize_t, bitposition, parametername_t...>
+        ::decompress(inBase, tokensize, outBase, parameters);
+      return (uint8_t *) inBase;
+    }
+  };
+}
+
+#endif /* LCTL_TRANSFORMATIONS_CODEGENERATION_UNROLLEDLOOPTRACKSCOMBINER_H */
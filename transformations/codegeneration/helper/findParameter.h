@@ -11,6 +11,7 @@
 #include "../../../language/calculation/Concat.h"
 #include "../../../language/collate/Concepts.h"
 #include "../../../intermediate/procedure/Concepts.h"
+#include "../../../codegeneration/Tracks.h"
 
 namespace LCTL {
   /**
@@ -36,6 +37,7 @@ namespace LCTL {
      * @brief    Primary Template is applied, if the parameter is not found.
      *           It writes a warning to cout.
      * 
+     * @tparam lanes_t          number of lanes in a vertical SIMD layout (1 in the scalar case)
      * @tparam compressedbase_t datatype of compressed values
      * @tparam parameters_t     datatypes of the runtime parameters
      * @param inBase             current address of memory area with compressed data
@@ -43,7 +45,7 @@ namespace LCTL {
      * 
      * @return 0
      */
-    template <typename compressedbase_t, typename... parameters_t>
+    template <size_t lanes_t = 1, typename compressedbase_t, typename... parameters_t>
     MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t decode (
       const compressedbase_t * & inBase,
       std::tuple<parameters_t... > parameters
@@ -99,6 +101,7 @@ namespace LCTL {
        *        Thus, recursive call of findParameter by deletion of the first parameter in the combiner.
        *        Propagation of the current bitposition + the bitwidth of the first parameter
        * 
+       * @tparam lanes_t          number of lanes in a vertical SIMD layout (1 in the scalar case)
        * @tparam compressedbase_t datatype of compressed values
        * @tparam parameters_t     datatypes of the runtime parameters
        * @param inBase             current address of memory area with compressed data
@@ -106,7 +109,7 @@ namespace LCTL {
        * 
        * @return result of the recursive call
        */
-      template <typename compressedbase_t, typename... parameters_t>
+      template <size_t lanes_t = 1, typename compressedbase_t, typename... parameters_t>
       MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t decode (
         const compressedbase_t * & inBase,
         std::tuple<parameters_t... > parameters
@@ -117,7 +120,7 @@ namespace LCTL {
             bitposition_t + numberOfBits_t, 
             base_t,
             parametername_t...
-          >::decode(inBase, parameters);
+          >::template decode<lanes_t>(inBase, parameters);
       }
   };
 
@@ -163,6 +166,7 @@ namespace LCTL {
     /**
      * @brief decoding of encoded value at this point
      * 
+     * @tparam lanes_t          number of lanes in a vertical SIMD layout (1 in the scalar case)
      * @tparam compressedbase_t datatype of compressed values
      * @tparam parameters_t     datatypes of the runtime parameters
      * @param inBase             current address of memory area with compressed data
@@ -170,29 +174,29 @@ namespace LCTL {
      * 
      * @return decoded parameter
      */
-      template <typename compressedbase_t, typename... parameters_t>
+      template <size_t lanes_t = 1, typename compressedbase_t, typename... parameters_t>
       MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t decode (
         const compressedbase_t * & inBase,
         std::tuple<parameters_t... > parameters
       ){
           /* 
            * bitposition_t is counted from the beginning of the block,
-           * offsetToInBase counts the offset form the beginning of the block based on the datatype compressedbase_t
+           * offsetToInBase counts the offset form the beginning of the block based on the datatype compressedbase_t.
+           * In a vertical SIMD layout, each compressed word is stored in lanes_t lanes (each containing the same parameter),
+           * thus we jump over lanes_t words per compressed word and only read the first lane.
            */
-          const size_t offsetToInBase = bitposition_t/(sizeof(compressedbase_t)*8);
-          /* at this address starts the parameter to decode */
-          const uint64_t * valuePtr = (uint64_t *) (inBase + offsetToInBase);
+          const size_t offsetToInBase = bitposition_t/(sizeof(compressedbase_t)*8) * lanes_t;
           /* calculation of the bitposition inside *valueptr, where the parameter bitstring starts */
           const size_t numberOfBitsToShiftRight = bitposition_t%(sizeof(compressedbase_t)*8);
           /* rightshift the value to bitposition 0 */
-          uint64_t decodedValue = * valuePtr >> numberOfBitsToShiftRight;
+          uint64_t decodedValue = (lanes_t == 1)
+            /* at this address starts the parameter to decode */
+            ? * (const uint64_t *) (inBase + offsetToInBase) >> numberOfBitsToShiftRight
+            /* the neighbouring word belongs to the next lane */
+            : (uint64_t) * (inBase + offsetToInBase) >> numberOfBitsToShiftRight;
           /* now it is possible, that the encoded parameter is a span value over 2 to 9 compressed words and we have to fetch the higher bits */
-          /*if (numberOfBits_t < 64) {
-            uint64_t moduloForRelevantBits = 1UL << numberOfBits_t;
-            decodedValue = decodedValue & ((1UL << numberOfBits_t) - 1);
-          }*/
-          for (int i = 1; i < ceil((numberOfBits_t + bitposition_t)/(sizeof(compressedbase_t)*8)); i++ )
-            decodedValue |= *(inBase + offsetToInBase + i) << (sizeof(compressedbase_t)*8 - bitposition_t) + i * sizeof(compressedbase_t)*8 ;
+          for (size_t i = 1; i < (numberOfBits_t + numberOfBitsToShiftRight + sizeof(compressedbase_t)*8 - 1)/(sizeof(compressedbase_t)*8); i++ )
+            decodedValue |= (uint64_t) *(inBase + offsetToInBase + i * lanes_t) << (i * sizeof(compressedbase_t)*8 - numberOfBitsToShiftRight);
           if (numberOfBits_t != 64)
             decodedValue = decodedValue & ((1UL << numberOfBits_t) - 1);
           return decodedValue;
@@ -201,6 +205,62 @@ namespace LCTL {
       
   };
 
+  /**
+   * @brief decoding of encoded parameters during the case of decompression.
+   *        Combiner with several output tracks.
+   *
+   * Parameters are encoded in the descriptor track (the first track), which is the last element of the runtime parameter tuple.
+   * Each block in the descriptor track starts at a word border, thus the search starts at bitposition 0.
+   * 
+   * @tparam descriptors_t   combine function of the descriptor track
+   * @tparam data_t          combine function of the data track
+   * @tparam aligned         true or false, does not matter
+   * @tparam namesearch_t    name of the parameter to decode
+   * @tparam bitposition_t   current bitposition in the data track, not used
+   * @tparam base_t          data type of the parameter and of the uncompressed data
+   * @tparam parametername_t currently parameter names of known parameters
+   */
+  template<
+    typename descriptors_t, 
+    typename data_t, 
+    bool aligned, 
+    typename namesearch_t, 
+    size_t bitposition_t, 
+    typename base_t,
+    typename... parametername_t
+  >
+  struct findParameter<
+    Combiner<Tracks<descriptors_t, data_t>, aligned>,
+    namesearch_t,
+    bitposition_t,
+    base_t,
+    parametername_t...>{
+    /**
+     * @brief recursive call with the combine function of the descriptor track and the current address in the descriptor track
+     * 
+     * @tparam lanes_t          number of lanes in a vertical SIMD layout (1 in the scalar case)
+     * @tparam compressedbase_t datatype of compressed values
+     * @tparam parameters_t     datatypes of the runtime parameters
+     * @param inBase             current address of memory area with compressed data (data track), not used
+     * @param parameters         currently decoded or calculated runtime parameters, the last one is the descriptor track
+     * 
+     * @return result of the recursive call: decoded parameter
+     */
+      template <size_t lanes_t = 1, typename compressedbase_t, typename... parameters_t>
+      MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t decode (
+        const compressedbase_t * & inBase,
+        std::tuple<parameters_t... > parameters
+      ){
+          return findParameter<
+            Combiner<descriptors_t, aligned>, 
+            namesearch_t, 
+            0, 
+            base_t,
+            parametername_t...
+          >::template decode<lanes_t>(std::get<DescriptorTrack<const compressedbase_t> *>(parameters)->base, parameters);
+      }
+  };
+
   /**
    * @brief decoding of encoded parameters during the case of decompression.
    *
@@ -252,6 +312,7 @@ namespace LCTL {
      * Because at this point, we won't find a general combiner, we simply use
      * the combiner deposited in the first case of the switch-case.
      * 
+     * @tparam lanes_t          number of lanes in a vertical SIMD layout (1 in the scalar case)
      * @tparam compressedbase_t datatype of compressed values
      * @tparam parameters_t     datatypes of the runtime parameters
      * @param inBase             current address of memory area with compressed data
@@ -259,7 +320,7 @@ namespace LCTL {
      * 
      * @return result of recursive call: decoded parameter
      */
-      template <typename compressedbase_t, typename... parameters_t>
+      template <size_t lanes_t = 1, typename compressedbase_t, typename... parameters_t>
       MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t decode (
         const compressedbase_t * & inBase,
         std::tuple<parameters_t... > parameters
@@ -270,7 +331,7 @@ namespace LCTL {
               namesearch_t, 
               bitposition_t, 
               base_t
-            >::decode(inBase, parameters);
+            >::template decode<lanes_t>(inBase, parameters);
       }
   };
 
@@ -313,6 +374,7 @@ namespace LCTL {
     /**
      * @brief recursive call of outer combiner, which should contain the parameter
      * 
+     * @tparam lanes_t          number of lanes in a vertical SIMD layout (1 in the scalar case)
      * @tparam compressedbase_t datatype of compressed values
      * @tparam parameters_t     datatypes of the runtime parameters
      * @param inBase             current address of memory area with compressed data
@@ -320,7 +382,7 @@ namespace LCTL {
      * 
      * @return result of recursive call: decoded parameter
      */
-      template <typename compressedbase_t, typename... parameters_t>
+      template <size_t lanes_t = 1, typename compressedbase_t, typename... parameters_t>
       MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t decode (
           const compressedbase_t * & inBase,
           std::tuple<parameters_t... > parameters
@@ -331,7 +393,7 @@ namespace LCTL {
               namesearch_t, 
               bitposition, 
               base_t
-            >::decode(inBase, parameters);
+            >::template decode<lanes_t>(inBase, parameters);
       }
   };
 
@@ -375,6 +437,7 @@ namespace LCTL {
     /**
      * @brief recursive call of child node, which should contain the parameter
      * 
+     * @tparam lanes_t          number of lanes in a vertical SIMD layout (1 in the scalar case)
      * @tparam compressedbase_t datatype of compressed values
      * @tparam parameters_t     datatypes of the runtime parameters
      * @param inBase             current address of memory area with compressed data
@@ -382,12 +445,12 @@ namespace LCTL {
      * 
      * @return result of recursive call: decoded parameter
      */
-      template <typename compressedbase_t, typename... parameters_t>
+      template <size_t lanes_t = 1, typename compressedbase_t, typename... parameters_t>
       MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t decode (
         const compressedbase_t * & inBase,
         std::tuple<parameters_t... > parameters
       ){
-          return findParameter<next_t, namesearch_t, bitposition, base_t>::decode(inBase, parameters);
+          return findParameter<next_t, namesearch_t, bitposition, base_t>::template decode<lanes_t>(inBase, parameters);
       }
   };
 
@@ -422,6 +485,7 @@ namespace LCTL {
     /**
      * @brief recursive call of child node (= combiner), which should contain the parameter
      * 
+     * @tparam lanes_t          number of lanes in a vertical SIMD layout (1 in the scalar case)
      * @tparam compressedbase_t datatype of compressed values
      * @tparam parameters_t     datatypes of the runtime parameters
      * @param inBase             current address of memory area with compressed data
@@ -429,12 +493,12 @@ namespace LCTL {
      * 
      * @return result of recursive call: decoded parameter
      */
-      template <typename compressedbase_t, typename... parameters_t>
+      template <size_t lanes_t = 1, typename compressedbase_t, typename... parameters_t>
       MSV_CXX_ATTRIBUTE_FORCE_INLINE static uint64_t decode (
         const compressedbase_t * & inBase,
         std::tuple<parameters_t... > parameters
       ){
-          return findParameter<comb_t, namesearch_t, bitposition, base_t>::decode(inBase, parameters);
+          return findParameter<comb_t, namesearch_t, bitposition, base_t>::template decode<lanes_t>(inBase, parameters);
       }
   };
 }
@@ -10,6 +10,8 @@
 
 #include "./Term.h"
 #include "./ParameterAnalyzer.h"
+#include "../../intermediate/calculation/tokenizer.h"
+#include <utility>
 
 namespace LCTL {
   
@@ -44,10 +46,11 @@ namespace LCTL {
   };
 
   /*
-   *  (A) most general loop, nothing is known: RolledLoopIR and unknown Tokenizer -> not yet iplemented
+   *  (A) most general loop, nothing is known: RolledLoopIR and unknown Tokenizer -> implemented for RunTokenizer (RLE)
    *  (B) inner Loop, where the overall input is known, but the inner tokensize is unknown -> UnrolledLoopIR with unknown Tokenizer not yet implemented, examples AFOR2, AFOR3 (not very important)
    *  (C) Loop with fix tokensize (stepwidth), at least one parameter and an input of unknown length -> RolledLoopIR with known Tokenizer
    *  (D) inner Loop with known overall input, known tokensize, example VarintGB with 4 value blocks and atomic tokens of 1 value
+   *  (E) Loop with a SwitchTokenizer (small set of known tokensizes) and an input of unknown length -> RolledLoopIR with SwitchTokenizerIR, example Simple-8b
    */
 
   /**
@@ -277,6 +280,147 @@ namespace LCTL {
               typename Term<outerCombiner_t,List<valueList_t...>,base_t, runtimeparameternames_t>::replace
           >;
   };
+
+  /**
+   * @brief (E) helper: each case of a SwitchTokenizer is an inner loop with a known overall input (the tokensize of the case).
+   * The selector (index of the case) and the bitwidth of the case are known values in the case.
+   * 
+   * @tparam base_t             input datatype
+   * @tparam level              recursion level
+   * @tparam name_t             name of the selector
+   * @tparam numberOfBits_t     number of bits to encode the selector
+   * @tparam bitwidthname_t     name of the bitwidth parameter of each case
+   * @tparam index_t...         selectors
+   * @tparam tokensize_t...     tokensizes of the cases
+   * @tparam bitwidth_t...      bitwidths of the cases
+   */
+  template <
+    typename base_t, 
+    int level, 
+    typename name_t,
+    typename numberOfBits_t,
+    typename bitwidthname_t,
+    typename indices_t,
+    typename cases_t,
+    typename loop_t, 
+    typename combinerList_t, 
+    typename valueList_t,
+    typename runtimeparameternames_t
+  >
+  struct SwitchTokenizerAnalyzer{};
+
+  template <
+    typename base_t, 
+    int level, 
+    typename name_t,
+    typename numberOfBits_t,
+    typename bitwidthname_t,
+    size_t... index_t,
+    size_t... tokensize_t,
+    size_t... bitwidth_t,
+    typename loop_t, 
+    typename... combinerList_t, 
+    typename... valueList_t,
+    typename runtimeparameternames_t
+  >
+  struct SwitchTokenizerAnalyzer<
+    base_t, 
+    level, 
+    name_t,
+    numberOfBits_t,
+    bitwidthname_t,
+    std::index_sequence<index_t...>,
+    List<TokenizerCase<tokensize_t, bitwidth_t>...>,
+    loop_t, 
+    List<combinerList_t...>, 
+    List<valueList_t...>, 
+    runtimeparameternames_t
+  >{
+    using transform = SwitchTokenizerIR<
+      name_t,
+      SelectTokenizerCaseIR<base_t, TokenizerCase<tokensize_t, bitwidth_t>...>,
+      numberOfBits_t,
+      KnownValueIR<
+        base_t,
+        name_t,
+        (base_t) index_t,
+        numberOfBits_t,
+        typename LoopAnalyzer<
+          base_t, 
+          level + 1, 
+          loop_t, 
+          List<combinerList_t...>, 
+          List<
+            std::tuple<bitwidthname_t, Size<level>, Value<base_t, (base_t) bitwidth_t>, NIL>,
+            std::tuple<name_t, Size<level>, Value<base_t, (base_t) index_t>, numberOfBits_t>,
+            std::tuple<String<decltype("tokensize"_tstr)>, Value<size_t, level>, Value<size_t, tokensize_t>, NIL>,
+            valueList_t...
+          >, 
+          /* overall input size of the case is known -> UnrolledLoopIR */
+          Size<tokensize_t>,
+          runtimeparameternames_t
+        >::transform
+      >...
+    >;
+  };
+
+  /**
+   * @brief (E) Loop with a SwitchTokenizer and an input of unknown length
+   * 
+   * @tparam base_t             input datatype
+   * @tparam level              recursion level
+   * @tparam name_t             name of the selector
+   * @tparam numberOfBits_t     number of bits to encode the selector
+   * @tparam bitwidthname_t     name of the bitwidth parameter of each case
+   * @tparam cases_t...         TokenizerCase<tokensize_t, bitwidth_t>
+   * @tparam loop_t             inner loop
+   * @tparam combiner_t         combiner of this loop
+   * @tparam outertokenizer_t   outer tokenizer (input size not known at compile time)
+   */
+  template <
+    typename base_t, 
+    int level, 
+    typename name_t,
+    typename numberOfBits_t,
+    typename bitwidthname_t,
+    typename... cases_t,
+    typename loop_t, 
+    typename combiner_t, 
+    typename outertokenizer_t, 
+    typename ...combinerList_t, 
+    typename ...valueList_t,
+    typename runtimeparameternames_t
+  >
+  struct LoopAnalyzer<
+    base_t, 
+    level, 
+    Loop<
+      SwitchTokenizer<name_t, numberOfBits_t, bitwidthname_t, cases_t...>, 
+      ParameterCalculator<>, 
+      loop_t, 
+      combiner_t>,
+    List<combinerList_t...>, 
+    List<valueList_t...>, 
+    outertokenizer_t,
+    runtimeparameternames_t
+  >{
+    using transform = RolledLoopIR<
+      typename SwitchTokenizerAnalyzer<
+        base_t, 
+        level, 
+        name_t,
+        numberOfBits_t,
+        bitwidthname_t,
+        std::make_index_sequence<sizeof...(cases_t)>,
+        List<cases_t...>,
+        loop_t, 
+        List<combiner_t, combinerList_t...>, 
+        List<valueList_t...>, 
+        runtimeparameternames_t
+      >::transform,
+      combiner_t
+    >;
+  };
   
 }
 
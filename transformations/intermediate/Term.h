@@ -10,6 +10,7 @@
 
 #include "../../language/calculation/aggregation.h"
 #include "../../language/calculation/arithmetics.h"
+#include "../../language/calculation/bitmanipulation.h"
 #include "helper/getPosParameterForGenerator.h"
 #include "../../language/calculation/Concat.h"
 
@@ -80,6 +81,31 @@ namespace LCTL {
       >;
   };
 
+  /* term y is a percentile calculation of term x, we enrich the term y with the tokensize and the term x recursively */
+  template<
+    typename term, 
+    size_t percent_t,
+    typename valueList_t, 
+    typename base_t, 
+    typename runtimeparameternames_t>
+  struct Term<
+    Percentile<term, percent_t>, 
+    valueList_t, 
+    base_t, 
+    runtimeparameternames_t>{
+      using replace = PercentileIR<
+        typename Term<term, valueList_t, base_t, runtimeparameternames_t>::replace, 
+        typename Term<
+          String<decltype("tokensize"_tstr)>, 
+          valueList_t, 
+          base_t,
+          runtimeparameternames_t
+        >::replace,
+        base_t,
+        percent_t
+      >;
+  };
+
   /* term y is a minimum calculation of term x, we enrich the term y with the tokensize and the term x recursively */
   template<
     typename term, 
@@ -103,6 +129,95 @@ namespace LCTL {
       >;
   };
 
+  /* term y is a sum calculation of term x, we enrich the term y with the tokensize and the term x recursively */
+  template<
+    typename term, 
+    typename valueList_t, 
+    typename base_t, 
+    typename runtimeparameternames_t>
+  struct Term<
+    Sum<term>, 
+    valueList_t, 
+    base_t, 
+    runtimeparameternames_t>{
+      using replace = SumIR<
+        typename Term<term, valueList_t, base_t, runtimeparameternames_t>::replace, 
+        typename Term<
+          String<decltype("tokensize"_tstr)>, 
+          valueList_t, 
+          base_t,
+          runtimeparameternames_t
+        >::replace,
+        base_t
+      >;
+  };
+
+  /* term y is an average calculation of term x, we enrich the term y with the tokensize and the term x recursively */
+  template<
+    typename term, 
+    typename valueList_t, 
+    typename base_t, 
+    typename runtimeparameternames_t>
+  struct Term<
+    Avg<term>, 
+    valueList_t, 
+    base_t, 
+    runtimeparameternames_t>{
+      using replace = AvgIR<
+        typename Term<term, valueList_t, base_t, runtimeparameternames_t>::replace, 
+        typename Term<
+          String<decltype("tokensize"_tstr)>, 
+          valueList_t, 
+          base_t,
+          runtimeparameternames_t
+        >::replace,
+        base_t
+      >;
+  };
+
+  /* term y is the last value of a block, we enrich the term y with the tokensize */
+  template<
+    typename term, 
+    typename valueList_t, 
+    typename base_t, 
+    typename runtimeparameternames_t>
+  struct Term<
+    Last<term>, 
+    valueList_t, 
+    base_t, 
+    runtimeparameternames_t>{
+      using replace = LastIR<
+        typename Term<term, valueList_t, base_t, runtimeparameternames_t>::replace, 
+        typename Term<
+          String<decltype("tokensize"_tstr)>, 
+          valueList_t, 
+          base_t,
+          runtimeparameternames_t
+        >::replace,
+        base_t
+      >;
+  };
+
+  /* differences inside of a block, the reference value is replaced recursively */
+  template<
+    typename term, 
+    typename ref_t,
+    size_t distance_t,
+    typename valueList_t, 
+    typename base_t, 
+    typename runtimeparameternames_t>
+  struct Term<
+    Delta<term, ref_t, distance_t>, 
+    valueList_t, 
+    base_t, 
+    runtimeparameternames_t>{
+      using replace = Delta<
+        typename Term<term, valueList_t, base_t, runtimeparameternames_t>::replace, 
+        typename Term<ref_t, valueList_t, base_t, runtimeparameternames_t>::replace, 
+        distance_t
+      >;
+  };
+
   /* term is a string/parameter name and the first value in the list of known values matches. 
    * We replace the string by the found value */
   template<
@@ -292,6 +407,38 @@ namespace LCTL {
         >;
   };
 
+  /* ZigZag mapping of a term, i.e. of a difference to a reference value */
+  template<
+    typename base_t, 
+    typename T, 
+    typename valueList_t, 
+    typename runtimeparameternames_t>
+  struct Term<
+    ZigZag<T>, 
+    valueList_t, 
+    base_t, 
+    runtimeparameternames_t>{
+      using replace = ZigZag<typename Term<T, valueList_t, base_t, runtimeparameternames_t>::replace>;
+  };
+
+  /* bitwise XOR of two terms, i.e. of a value and its predecessor */
+  template<
+    typename base_t, 
+    typename U, 
+    typename T, 
+    typename valueList_t, 
+    typename runtimeparameternames_t>
+  struct Term<
+    Xor<U, T>, 
+    valueList_t, 
+    base_t, 
+    runtimeparameternames_t>{
+      using replace = Xor<
+          typename Term<U, valueList_t, base_t, runtimeparameternames_t>::replace, 
+          typename Term<T, valueList_t, base_t, runtimeparameternames_t>::replace
+        >;
+  };
+
   template <
     bool aligned, 
     typename valueList_t, 
@@ -331,6 +478,27 @@ namespace LCTL {
       >;   
   };
     
+
+  /* several output tracks: each track is a concat combiner of its own */
+  template <
+    typename... U, 
+    bool aligned,  
+    typename valueList_t, 
+    typename base_t, 
+    typename runtimeparameternames_t>
+  struct Term<
+    Combiner<Tracks<U...>, aligned>, 
+    valueList_t, 
+    base_t, 
+    runtimeparameternames_t>{
+      using replace = Combiner<
+          Tracks<
+            typename Term<Combiner<U, aligned>, valueList_t, base_t, runtimeparameternames_t>::replace::func_combine_t...
+          >,
+          aligned
+      >;   
+  };
+    
 }
 
 #endif /* LCTL_TRANSFORMATION_INTERMEDIATE_TERM_H */